@@ -86,6 +86,9 @@ namespace pksm
         [[nodiscard]] std::unique_ptr<PK7> convertToG7(Sav& save) const override;
         // [[nodiscard]] std::unique_ptr<PB7> convertToLGPE(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK8> convertToG8(Sav& save) const override;
+        // Same as convertToG7(save), but writes into pk7 instead of allocating. pk7 must be a
+        // box-length PK7 whose data is all zero, such as a PKXView over a zeroed buffer
+        void convertToG7(PK7& pk7, Sav& save) const;
 
         [[nodiscard]] std::unique_ptr<PKX> clone(void) const override;
 
@@ -127,11 +130,13 @@ namespace pksm
         [[nodiscard]] std::string nickname(void) const override;
         [[nodiscard]] std::string nicknameTransporter(void) const;
         void nickname(const std::string_view& v) override;
+        size_t nickname(char* out, size_t size) const override;
         [[nodiscard]] Language language(void) const override;
         void language(Language v) override;
         void languageOverrideLimits(Language v);
         [[nodiscard]] std::string otName(void) const override;
         void otName(const std::string_view& v) override;
+        size_t otName(char* out, size_t size) const override;
         [[nodiscard]] std::string transferOT(Language lang) const;
 
         [[nodiscard]] u16 markValue(void) const override { return 0; }
@@ -88,6 +88,9 @@ namespace pksm
         [[nodiscard]] std::unique_ptr<PK7> convertToG7(Sav& save) const override;
         // std::unique_ptr<PB7> convertToLGPE(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK8> convertToG8(Sav& save) const override;
+        // Same as convertToG4(save), but writes into pk4 instead of allocating. pk4 must be a
+        // box-length PK4 whose data is all zero, such as a PKXView over a zeroed buffer
+        void convertToG4(PK4& pk4, Sav& save) const;
 
         [[nodiscard]] std::unique_ptr<PKX> clone(void) const override;
 
@@ -118,6 +121,7 @@ namespace pksm
         void SID(u16 v) override;
         [[nodiscard]] std::string nickname(void) const override;
         void nickname(const std::string_view& v) override;
+        size_t nickname(char* out, size_t size) const override;
         [[nodiscard]] Language language(void) const override;
         void language(Language v) override;
         [[nodiscard]] bool flagIsBadEgg(void) const;
@@ -128,6 +132,7 @@ namespace pksm
         void flagIsEgg(bool v);
         [[nodiscard]] std::string otName(void) const override;
         void otName(const std::string_view& v) override;
+        size_t otName(char* out, size_t size) const override;
         [[nodiscard]] u16 markValue(void) const override;
         void markValue(u16 v) override;
         [[nodiscard]] u16 checksum(void) const override;
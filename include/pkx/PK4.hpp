@@ -37,6 +37,10 @@ namespace pksm
     private:
         static constexpr size_t BLOCK_LENGTH     = 32;
         static constexpr size_t ENCRYPTION_START = 8;
+        // These neither check nor update the state of the data; that's up to the caller
+        static void encrypt(u8* data, bool party);
+        static void decrypt(u8* data, bool party);
+        [[nodiscard]] static u16 calcChecksum(const u8* data);
         [[nodiscard]] int eggYear(void) const override;
         void eggYear(int v) override;
         [[nodiscard]] int eggMonth(void) const override;
@@ -73,6 +77,9 @@ namespace pksm
         [[nodiscard]] std::unique_ptr<PK7> convertToG7(Sav& save) const override;
         // std::unique_ptr<PB7> convertToLGPE(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK8> convertToG8(Sav& save) const override;
+        // Same as convertToG5(save), but writes into pk5 instead of allocating. pk5 must be a
+        // box-length PK5 whose data is all zero, such as a PKXView over a zeroed buffer
+        void convertToG5(PK5& pk5, Sav& save) const;
 
         [[nodiscard]] std::unique_ptr<PKX> clone(void) const override;
 
@@ -80,6 +87,15 @@ namespace pksm
         void decrypt(void) override;
         void encrypt(void) override;
         [[nodiscard]] bool isEncrypted(void) const override;
+        // Whether the Pokemon stored at data is encrypted, without constructing a PK4
+        [[nodiscard]] static bool isEncrypted(const u8* data);
+        // Decrypts only blocks [first, last) of the encrypted Pokemon stored at data, and writes
+        // them and the unencrypted header to where they belong in out, which is BOX_LENGTH long
+        static void decryptBlocks(const u8* data, u8* out, size_t first, size_t last);
+        // Decrypts (if crypted) or encrypts count Pokemon stored back to back at data, in place.
+        // The same as constructing each with getPKM(..., true) and, if !crypted, calling
+        // encrypt(), but without creating any PK4 objects
+        static void cryptBoxData(u8* data, size_t count, bool party, bool crypted);
 
         [[nodiscard]] bool isParty(void) const override { return getLength() == PARTY_LENGTH; }
 
@@ -167,11 +183,13 @@ namespace pksm
 
         [[nodiscard]] std::string nickname(void) const override;
         void nickname(const std::string_view& v) override;
+        size_t nickname(char* out, size_t size) const override;
         [[nodiscard]] GameVersion version(void) const override;
         void version(GameVersion v) override;
 
         [[nodiscard]] std::string otName(void) const override;
         void otName(const std::string_view& v) override;
+        size_t otName(char* out, size_t size) const override;
         [[nodiscard]] u16 eggLocation(void) const override;
         void eggLocation(u16 v) override;
         [[nodiscard]] u16 metLocation(void) const override;
@@ -37,6 +37,10 @@ namespace pksm
     private:
         static constexpr size_t BLOCK_LENGTH     = 56;
         static constexpr size_t ENCRYPTION_START = 8;
+        // These neither check nor update the state of the data; that's up to the caller
+        static void encrypt(u8* data, bool party);
+        static void decrypt(u8* data, bool party);
+        [[nodiscard]] static u16 calcChecksum(const u8* data);
         [[nodiscard]] int eggYear(void) const override;
         void eggYear(int v) override;
         [[nodiscard]] int eggMonth(void) const override;
@@ -70,6 +74,9 @@ namespace pksm
         [[nodiscard]] std::unique_ptr<PK6> convertToG6(Sav& save) const override;
         // std::unique_ptr<PKX> convertToLGPE(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK8> convertToG8(Sav& save) const override;
+        // Same as convertToG8(save), but writes into pk8 instead of allocating. pk8 must be a
+        // box-length PK8 whose data is all zero, such as a PKXView over a zeroed buffer
+        void convertToG8(PK8& pk8, Sav& save) const;
 
         [[nodiscard]] std::unique_ptr<PKX> clone(void) const override;
 
@@ -77,6 +84,15 @@ namespace pksm
         void decrypt(void) override;
         void encrypt(void) override;
         [[nodiscard]] bool isEncrypted(void) const override;
+        // Whether the Pokemon stored at data is encrypted, without constructing a PK7
+        [[nodiscard]] static bool isEncrypted(const u8* data);
+        // Decrypts only blocks [first, last) of the encrypted Pokemon stored at data, and writes
+        // them and the unencrypted header to where they belong in out, which is BOX_LENGTH long
+        static void decryptBlocks(const u8* data, u8* out, size_t first, size_t last);
+        // Decrypts (if crypted) or encrypts count Pokemon stored back to back at data, in place.
+        // The same as constructing each with getPKM(..., true) and, if !crypted, calling
+        // encrypt(), but without creating any PK7 objects
+        static void cryptBoxData(u8* data, size_t count, bool party, bool crypted);
 
         [[nodiscard]] bool isParty(void) const override { return getLength() == PARTY_LENGTH; }
 
@@ -137,6 +153,7 @@ namespace pksm
 
         [[nodiscard]] std::string nickname(void) const override;
         void nickname(const std::string_view& v) override;
+        size_t nickname(char* out, size_t size) const override;
         [[nodiscard]] Move move(u8 move) const override;
         void move(u8 move, Move v) override;
         [[nodiscard]] u8 PP(u8 move) const override;
@@ -185,6 +202,7 @@ namespace pksm
 
         [[nodiscard]] std::string otName(void) const override;
         void otName(const std::string_view& v) override;
+        size_t otName(char* out, size_t size) const override;
         [[nodiscard]] u8 otFriendship(void) const override;
         void otFriendship(u8 v) override;
         [[nodiscard]] u8 otAffection(void) const;
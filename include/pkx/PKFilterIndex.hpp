@@ -0,0 +1,135 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef PKFILTERINDEX_HPP
+#define PKFILTERINDEX_HPP
+
+#include "pkx/PKFilter.hpp"
+#include "sav/BoxSnapshot.hpp"
+#include "utils/coretypes.h"
+#include <unordered_map>
+#include <vector>
+
+namespace pksm
+{
+    class PKX;
+    class Sav;
+
+    class PKFilterIndex;
+
+    // A PKFilter flattened into the list of comparisons it makes, so that it can be run over a
+    // PKFilterIndex column by column instead of through PKX's getters one Pokemon at a time
+    class CompiledPKFilter
+    {
+        friend class PKFilterIndex;
+
+    public:
+        explicit CompiledPKFilter(const PKFilter& filter);
+
+    private:
+        enum class Op : u8
+        {
+            // Passes if inverse == (value != operand)
+            NotEqual,
+            // Passes if inverse == (value < operand)
+            Less
+        };
+
+        struct Check
+        {
+            u8 column;
+            Op op;
+            bool inverse;
+            u16 operand;
+        };
+
+        std::vector<Check> checks;
+    };
+
+    // A BoxSnapshot of a save, which has every field a PKFilter can look at, along with bitmaps of
+    // which slots hold each species and each move. Slots are numbered the same way as maxSlot()
+    // counts them
+    class PKFilterIndex
+    {
+        friend class CompiledPKFilter;
+
+    public:
+        explicit PKFilterIndex(const Sav& save);
+
+        [[nodiscard]] int size(void) const { return snapshot.size(); }
+
+        // Every non-empty slot that filter matches, in order; the same ones that
+        // pkm(box, slot) == filter would be true for
+        [[nodiscard]] std::vector<int> find(const CompiledPKFilter& filter) const;
+
+        // Must be called with the new contents of a slot whenever the save's copy changes
+        void update(int slot, const PKX& pk);
+
+        [[nodiscard]] const BoxSnapshot& columns(void) const { return snapshot; }
+
+    private:
+        // Which BoxSnapshot column a check reads
+        enum Column : u8
+        {
+            GENERATION,
+            SPECIES,
+            FORM,
+            SHINY,
+            HELD_ITEM,
+            LEVEL,
+            ABILITY,
+            TSV,
+            NATURE,
+            GENDER,
+            MOVE,
+            RELEARN_MOVE = MOVE + 4,
+            // Whether the format has relearn moves at all; filtering by them fails otherwise
+            HAS_RELEARN_MOVES = RELEARN_MOVE + 4,
+            BALL,
+            LANGUAGE,
+            EGG,
+            IV
+        };
+
+        using Bitmap = std::vector<u64>;
+
+        // Adds or removes a slot from the bitmaps; empty slots are never in them
+        void indexSlot(int slot, bool set);
+        void setIndexed(std::unordered_map<u16, Bitmap>& index, u16 value, int slot, bool set);
+        [[nodiscard]] u64 evaluate(const CompiledPKFilter::Check& check, size_t word) const;
+        // Bit i is set if check passes for slot word * 64 + i, whose value is value(slot)
+        template <typename Value>
+        [[nodiscard]] static u64 evaluateColumn(
+            const CompiledPKFilter::Check& check, size_t word, size_t count, Value&& value);
+
+        BoxSnapshot snapshot;
+        Bitmap occupied;
+        std::unordered_map<u16, Bitmap> speciesIndex;
+        std::unordered_map<u16, Bitmap> moveIndex;
+    };
+}
+
+#endif
@@ -88,6 +88,7 @@ namespace pksm
         PKX(u8* data, size_t length, bool directAccess = false);
 
         [[nodiscard]] u32 expTable(u8 row, u8 col) const;
+        [[nodiscard]] u8 levelFromExp(u32 exp, u8 type) const;
         virtual void reorderMoves(void);
 
         u32 length = 0;
@@ -280,6 +281,11 @@ namespace pksm
         [[nodiscard]] virtual u8 htFriendship(void) const    = 0;
         virtual void htFriendship(u8 v)                      = 0;
 
+        // nickname() and otName() without allocating: each writes null-terminated UTF-8 into the
+        // size bytes at out, cut off at a codepoint if it doesn't fit, and returns its length
+        virtual size_t nickname(char* out, size_t size) const = 0;
+        virtual size_t otName(char* out, size_t size) const   = 0;
+
         // Raw information handled in private functions
         [[nodiscard]] virtual Date eggDate(void) const
         {
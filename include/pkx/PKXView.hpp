@@ -0,0 +1,63 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef PKXVIEW_HPP
+#define PKXVIEW_HPP
+
+#include "pkx/PB7.hpp"
+#include "pkx/PK1.hpp"
+#include "pkx/PK2.hpp"
+#include "pkx/PK3.hpp"
+#include "pkx/PK4.hpp"
+#include "pkx/PK5.hpp"
+#include "pkx/PK6.hpp"
+#include "pkx/PK7.hpp"
+#include "pkx/PK8.hpp"
+#include "pkx/PKX.hpp"
+#include <concepts>
+
+namespace pksm
+{
+    // A Pkm that reads and writes straight through to data, which must outlive it; neither the
+    // object nor the data is ever allocated, so it can live on the stack. Like
+    // getPKM(..., true), it decrypts data in place if it's encrypted. Since it's final, calls
+    // through a PKXView<Pkm> don't need virtual dispatch.
+    // For PK1 and PK2, party is whether the data is Japanese, just as for getPKM's lengths
+    template <std::derived_from<PKX> Pkm>
+    class PKXView final : public Pkm
+    {
+    public:
+        PKXView(u8* data, bool party)
+            : Pkm(typename PKX::PrivateConstructor{}, data, party, true)
+        {
+        }
+
+        PKXView(const PKXView&)            = delete;
+        PKXView& operator=(const PKXView&) = delete;
+    };
+}
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef BOXSNAPSHOT_HPP
+#define BOXSNAPSHOT_HPP
+
+#include "utils/coretypes.h"
+#include <array>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace pksm
+{
+    class PKX;
+    class Sav;
+
+    // Hands out memory aligned to a cache line, so that columns don't share one with anything else
+    // and loops over them start on a boundary
+    template <typename T>
+    struct CacheAlignedAllocator
+    {
+        using value_type = T;
+
+        static constexpr std::align_val_t ALIGNMENT{64};
+
+        CacheAlignedAllocator(void) = default;
+        template <typename U>
+        constexpr CacheAlignedAllocator(const CacheAlignedAllocator<U>&) noexcept
+        {
+        }
+
+        [[nodiscard]] T* allocate(size_t count)
+        {
+            return static_cast<T*>(::operator new(count * sizeof(T), ALIGNMENT));
+        }
+        void deallocate(T* ptr, size_t) noexcept { ::operator delete(ptr, ALIGNMENT); }
+
+        template <typename U>
+        bool operator==(const CacheAlignedAllocator<U>&) const noexcept
+        {
+            return true;
+        }
+    };
+
+    // Every box slot of a save decoded once into one array per field, for going over all of them
+    // many times without a PKX or a virtual call per value. Slots are numbered the same way as
+    // maxSlot() counts them, and every column is indexed by slot; multi-valued fields are arrays
+    // of columns, so ivs[u8(Stat::SPD)][slot] is a slot's speed IV. Values are what the PKX
+    // getters return, stored as their underlying integers, so they mean the same thing for
+    // every format: Gen 1 and 2 EVs are stat experience, and natures are the ones those games
+    // derive from experience. Empty slots are left all zero
+    struct BoxSnapshot
+    {
+        template <typename T>
+        using Column = std::vector<T, CacheAlignedAllocator<T>>;
+
+        explicit BoxSnapshot(const Sav& save);
+
+        [[nodiscard]] int size(void) const { return slots; }
+
+        // Must be called with the new contents of a slot whenever the save's copy changes
+        void update(int slot, const PKX& pk);
+
+        Column<u8> generation;
+        Column<u16> species;
+        Column<u16> form;
+        Column<u8> level;
+        Column<u8> shiny;
+        Column<u8> egg;
+        Column<u8> gender;
+        Column<u8> nature;
+        Column<u16> ability;
+        Column<u16> heldItem;
+        Column<u8> ball;
+        Column<u8> language;
+        Column<u32> PID;
+        Column<u16> TID;
+        Column<u16> SID;
+        Column<u16> TSV;
+        std::array<Column<u8>, 6> ivs;
+        std::array<Column<u16>, 6> evs;
+        std::array<Column<u16>, 4> moves;
+        std::array<Column<u16>, 4> relearnMoves;
+
+    private:
+        template <typename Pkm>
+        void read(int slot, const Pkm& pk);
+        template <typename Function>
+        void forEachColumn(Function&& function);
+
+        int slots;
+    };
+}
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef DEXFORMTABLE_HPP
+#define DEXFORMTABLE_HPP
+
+#include "utils/coretypes.h"
+#include <array>
+#include <cstddef>
+
+namespace pksm
+{
+    // Gen 7 and LGPE formtable lookups by species, built at compile time so that the dex doesn't
+    // search the table for every species it touches. formtable is pairs of u16 species and u16
+    // form count, sorted by species
+    template <size_t MaxSpecies>
+    class DexFormTable
+    {
+    public:
+        template <size_t N>
+        consteval explicit DexFormTable(const u16 (&formtable)[N])
+        {
+            u16 index   = 0;
+            u8 previous = 0;
+            for (size_t i = 0; i < N; i += 2)
+            {
+                if (formtable[i] <= MaxSpecies && entries[formtable[i]].count == 0)
+                {
+                    entries[formtable[i]] = {index, u8(formtable[i + 1]), previous};
+                }
+                previous = formtable[i + 1];
+                index    += formtable[i + 1] - 1;
+            }
+
+            // Species without an entry get what searching the whole table would have left
+            missing = {index, 0, previous};
+            for (auto& entry : entries)
+            {
+                if (entry.count == 0)
+                {
+                    entry = missing;
+                }
+            }
+        }
+
+        // 0 for species that aren't in the table
+        [[nodiscard]] constexpr int count(int species) const { return find(species).count; }
+
+        // Same as summing the form counts (minus one each) of every species before this one onto
+        // start. The search this replaces gave up with -1 when the previous species had more forms
+        // than formct, and so does this
+        [[nodiscard]] constexpr int index(int species, int formct, int start) const
+        {
+            const Entry& entry = find(species);
+            return entry.previousCount > formct ? -1 : start + entry.index;
+        }
+
+    private:
+        struct Entry
+        {
+            u16 index        = 0;
+            u8 count         = 0;
+            u8 previousCount = 0;
+        };
+
+        std::array<Entry, MaxSpecies + 1> entries{};
+        Entry missing{};
+
+        [[nodiscard]] constexpr const Entry& find(int species) const
+        {
+            return species >= 0 && size_t(species) <= MaxSpecies ? entries[species] : missing;
+        }
+    };
+}
+
+#endif
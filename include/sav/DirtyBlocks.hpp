@@ -0,0 +1,77 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef DIRTYBLOCKS_HPP
+#define DIRTYBLOCKS_HPP
+
+#include "utils/coretypes.h"
+#include <array>
+#include <bitset>
+#include <functional>
+
+namespace pksm
+{
+    // Which of a save's checksummed blocks were written to since their checksums were last
+    // computed. Blocks have to be sorted by offset and can't overlap. Everything starts out dirty,
+    // so the first resign after loading covers the whole save
+    class DirtyBlocks
+    {
+    public:
+        static constexpr size_t MAX_BLOCKS = 74;
+        // Below this many dirty bytes, starting threads costs more than it saves
+        static constexpr size_t PARALLEL_BYTES = 0x20000;
+
+        template <typename Offset, typename Length, size_t N>
+        DirtyBlocks(const Offset (&offsets)[N], const Length (&lengths)[N]) : count(N)
+        {
+            static_assert(N <= MAX_BLOCKS);
+            for (size_t i = 0; i < N; i++)
+            {
+                starts[i] = offsets[i];
+                ends[i]   = offsets[i] + lengths[i];
+            }
+            dirty.set();
+        }
+
+        // Marks every block that overlaps [offset, offset + length)
+        void mark(u32 offset, size_t length = 1);
+
+        void markBlock(size_t block) { dirty.set(block); }
+
+        // Calls checksum(i) for every dirty block i in [first, last) and marks them clean, and
+        // returns whether there were any. Once they add up to PARALLEL_BYTES they're split
+        // between threads, so checksum may only write to block i's own checksum
+        bool resign(const std::function<void(size_t)>& checksum, size_t first = 0,
+            size_t last = MAX_BLOCKS);
+
+    private:
+        std::array<u32, MAX_BLOCKS> starts, ends;
+        size_t count;
+        std::bitset<MAX_BLOCKS> dirty;
+    };
+}
+
+#endif
@@ -35,14 +35,18 @@
 #include "enums/Language.hpp"
 #include "enums/Species.hpp"
 #include "pkx/PKX.hpp"
+#include "pkx/PKXView.hpp"
 #include "sav/Item.hpp"
 #include "utils/coretypes.h"
 #include "utils/DateTime.hpp"
 #include "utils/SmallVector.hpp"
 #include "utils/VersionTables.hpp"
 #include "wcx/WCX.hpp"
+#include <algorithm>
+#include <bitset>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <type_traits>
 #include <vector>
@@ -86,6 +90,76 @@ namespace pksm
         [[nodiscard]] static std::unique_ptr<Sav> checkDSType(const std::shared_ptr<u8[]>& dt);
         [[nodiscard]] static bool validSequence(const std::shared_ptr<u8[]>& dt, size_t offset);
 
+        // Where a slot is stored in the same format as the save's PKX, for forEachPkm, or nullptr
+        // if it has to be assembled or converted by pkm() first
+        [[nodiscard]] virtual u8* boxSlotData(u8, u8) const { return nullptr; }
+
+        [[nodiscard]] virtual u8* partySlotData(u8) const { return nullptr; }
+
+        // What dex() does for this game. dex() updates the dex summary afterwards
+        virtual void writeDex(const PKX& pk) = 0;
+        // Only ever asked about species the game has
+        [[nodiscard]] virtual bool speciesSeen(Species species) const   = 0;
+        [[nodiscard]] virtual bool speciesCaught(Species species) const = 0;
+
+    private:
+        // Views data itself if it's decrypted, and otherwise a decrypted copy of it on the stack,
+        // so that visiting never changes the save
+        template <typename Pkm, typename Visitor>
+        static void visitPkmData(Visitor& visitor, u8* data, bool party, u8 box, u8 slot)
+        {
+            if (Pkm::isEncrypted(data))
+            {
+                u8 copy[Pkm::PARTY_LENGTH];
+                std::copy_n(data, party ? Pkm::PARTY_LENGTH : Pkm::BOX_LENGTH, copy);
+                visitor(PKXView<Pkm>(copy, party), box, slot);
+            }
+            else
+            {
+                visitor(PKXView<Pkm>(data, party), box, slot);
+            }
+        }
+
+        template <typename Pkm, typename Visitor>
+        void forEachPkmAs(Visitor& visitor) const
+        {
+            constexpr bool viewable = requires(const u8* data) { Pkm::isEncrypted(data); };
+            // LGPE and SwSh keep party data for boxed Pokemon as well
+            constexpr bool partyBoxes = std::is_same_v<Pkm, PB7> || std::is_same_v<Pkm, PK8>;
+            constexpr bool gameBoy    = std::is_same_v<Pkm, PK1> || std::is_same_v<Pkm, PK2>;
+
+            const int slots    = maxSlot();
+            const int boxSlots = gameBoy ? slots / maxBoxes() : 30;
+            for (int box = 0; box < maxBoxes(); box++)
+            {
+                for (int slot = 0; slot < boxSlots && box * boxSlots + slot < slots; slot++)
+                {
+                    if constexpr (viewable)
+                    {
+                        if (u8* data = boxSlotData(box, slot))
+                        {
+                            visitPkmData<Pkm>(visitor, data, partyBoxes, box, slot);
+                            continue;
+                        }
+                    }
+                    visitor(static_cast<const Pkm&>(*pkm(box, slot)), u8(box), u8(slot));
+                }
+            }
+
+            for (u8 slot = 0; slot < partyCount(); slot++)
+            {
+                if constexpr (viewable)
+                {
+                    if (u8* data = partySlotData(slot))
+                    {
+                        visitPkmData<Pkm>(visitor, data, true, PARTY_BOX, slot);
+                        continue;
+                    }
+                }
+                visitor(static_cast<const Pkm&>(*pkm(slot)), PARTY_BOX, slot);
+            }
+        }
+
     public:
         enum class Pouch
         {
@@ -116,6 +190,17 @@ namespace pksm
             BALL
         };
 
+        enum class OpenMode
+        {
+            // Edits stay in memory. Pages are only copied once something writes to them. SwSh
+            // saves are decrypted in place on load, so those are copied in full
+            COPY_ON_WRITE,
+            // Edits go straight to the file, and only the pages that were written to are written
+            // back. The file holds whatever the save's memory does, so call finishEditing before
+            // the save is destroyed. Not available for SwSh saves, or where files can't be mapped
+            WRITE_THROUGH
+        };
+
         virtual ~Sav() = default;
 
         Sav(const std::shared_ptr<u8[]>& data, u32 length) : data(data), length(length) {}
@@ -127,12 +212,108 @@ namespace pksm
         // Must be called to continue editing after calling finishEditing.
         // Not necessary directly after construction
         virtual void beginEditing(void) = 0;
+        // Saves that only recompute the checksums of what was written to since the last
+        // finishEditing track their own writes, but not writes made directly to rawData(). Those
+        // have to be reported here
+        virtual void markDirty(u32, size_t = 1) {}
 
         [[nodiscard]] BadTransferReason invalidTransferReason(const PKX& pk) const;
         [[nodiscard]] std::unique_ptr<PKX> transfer(const PKX& pk);
+
+        struct TransferredSlot
+        {
+            enum class Result
+            {
+                TRANSFERRED,
+                INVALID,         // reason says why
+                NOT_CONVERTIBLE, // transfer() can't convert it to this save's format
+                NO_SPACE         // Every box slot from toBox on is taken
+            };
+
+            u8 fromBox;
+            u8 fromSlot;
+            // Only meaningful if it was transferred
+            u8 toBox;
+            u8 toSlot;
+            Result result;
+            BadTransferReason reason;
+        };
+
+        // Copies every Pokemon in boxes [fromBox, fromBox + boxCount) of source into the empty box
+        // slots of this save, filling them in order from the start of toBox, and registers them in
+        // the dex. Nothing is overwritten, and source, which has to be a different save, isn't
+        // changed; clear the transferred slots in it to move them instead. LGPE slots are packed
+        // afterwards, and the positions reported are where they end up. Source slots are read
+        // through forEachPkm and ones that are already in this save's format are written without
+        // converting. Converting to a later generation goes through views on the stack instead of
+        // allocating each step, and the result matches what transfer() makes. Returns one entry
+        // per non-empty source slot, in source order
+        [[nodiscard]] std::vector<TransferredSlot> transferBoxes(
+            const Sav& source, u8 fromBox, u8 boxCount, u8 toBox = 0, bool applyTrade = true);
         [[nodiscard]] static bool isValidDSSave(const std::shared_ptr<u8[]>& dt);
         [[nodiscard]] static std::unique_ptr<Sav> getSave(
             const std::shared_ptr<u8[]>& dt, size_t length);
+        // Maps the file at path into memory instead of reading it, where the platform supports
+        // that, and then does the same as getSave. Returns nullptr if it can't be opened or
+        // recognized, or if mode isn't available for it
+        [[nodiscard]] static std::unique_ptr<Sav> openFile(const std::string& path, OpenMode mode);
+
+        // The box forEachPkm passes for party slots
+        static constexpr u8 PARTY_BOX = 0xFF;
+
+        struct SlotSummary
+        {
+            Species species = Species::None;
+            u8 form         = 0;
+            u8 level        = 0;
+            bool shiny      = false;
+            bool egg        = false;
+        };
+
+        // Summarizes every box slot, in the same order as maxSlot() counts them; empty slots have
+        // species None. Only the data needed for that is read, and it's never modified
+        [[nodiscard]] std::vector<SlotSummary> scanBoxes(void) const;
+
+        // Calls visitor(pk, box, slot) for every box slot, empty or not, and then for every party
+        // slot, with box set to PARTY_BOX. pk is a const reference to the save's own PKX type, and
+        // is only valid during the call. Wherever the save stores it in that format, pk is a
+        // PKXView of the save's memory instead of a pkm() copy, so nothing gets allocated
+        template <typename Visitor>
+        void forEachPkm(Visitor&& visitor) const
+        {
+            switch (generation())
+            {
+                case Generation::ONE:
+                    forEachPkmAs<PK1>(visitor);
+                    break;
+                case Generation::TWO:
+                    forEachPkmAs<PK2>(visitor);
+                    break;
+                case Generation::THREE:
+                    forEachPkmAs<PK3>(visitor);
+                    break;
+                case Generation::FOUR:
+                    forEachPkmAs<PK4>(visitor);
+                    break;
+                case Generation::FIVE:
+                    forEachPkmAs<PK5>(visitor);
+                    break;
+                case Generation::SIX:
+                    forEachPkmAs<PK6>(visitor);
+                    break;
+                case Generation::SEVEN:
+                    forEachPkmAs<PK7>(visitor);
+                    break;
+                case Generation::LGPE:
+                    forEachPkmAs<PB7>(visitor);
+                    break;
+                case Generation::EIGHT:
+                    forEachPkmAs<PK8>(visitor);
+                    break;
+                case Generation::UNUSED:
+                    break;
+            }
+        }
 
         [[nodiscard]] virtual u16 TID(void) const             = 0;
         virtual void TID(u16 v)                               = 0;
@@ -164,6 +345,10 @@ namespace pksm
         [[nodiscard]] virtual u8 playedSeconds(void) const    = 0;
         virtual void playedSeconds(u8 v)                      = 0;
 
+        // otName() and boxName() without allocating, the same way as PKX::nickname(char*, size_t)
+        virtual size_t otName(char* out, size_t size) const          = 0;
+        virtual size_t boxName(u8 box, char* out, size_t size) const = 0;
+
         [[nodiscard]] u32 displayTID(void) const;
         [[nodiscard]] u32 displaySID(void) const;
 
@@ -183,9 +368,24 @@ namespace pksm
             const Date& date = Date::today()) const = 0; // Look into bank boolean parameter
         [[nodiscard]] virtual std::unique_ptr<PKX> emptyPkm() const = 0;
 
-        virtual void dex(const PKX& pk)                                       = 0;
-        [[nodiscard]] virtual int dexSeen(void) const                         = 0;
-        [[nodiscard]] virtual int dexCaught(void) const                       = 0;
+        // Seen and caught flags by national dex number, for the species the game has
+        struct DexSummary
+        {
+            std::bitset<size_t(Species::Calyrex) + 1> seen, caught;
+            int seenCount = 0, caughtCount = 0;
+        };
+
+        void dex(const PKX& pk);
+        // Read from the save once, and kept up to date by dex() after that. Anything that changes
+        // the dex flags some other way, such as writing to rawData(), has to call dexChanged for
+        // the species it changed
+        [[nodiscard]] const DexSummary& dexSummary(void) const;
+        void dexChanged(Species species);
+
+        [[nodiscard]] int dexSeen(void) const { return dexSummary().seenCount; }
+
+        [[nodiscard]] int dexCaught(void) const { return dexSummary().caughtCount; }
+
         [[nodiscard]] virtual int currentGiftAmount(void) const               = 0;
         [[nodiscard]] virtual std::unique_ptr<WCX> mysteryGift(int pos) const = 0;
         virtual void mysteryGift(const WCX& wc, int& pos)                     = 0;
@@ -197,6 +397,11 @@ namespace pksm
         [[nodiscard]] virtual u8 partyCount(void) const                       = 0;
         virtual void partyCount(u8 count)                                     = 0;
         virtual void fixParty(void); // Has to be overridden by SavLGPE because it works stupidly
+        // Brings whatever bookkeeping a save has about its boxes back in line after their slots
+        // were written to one by one. SavLGPE packs them and counts them again, and Sav1 and Sav2
+        // close the gaps in each box and rebuild its count and species list. transferBoxes calls
+        // this once it's done, and relies on it for all three
+        virtual void fixBoxes(void) {}
 
         [[nodiscard]] virtual int maxSlot(void) const { return maxBoxes() * 30; }
 
@@ -229,6 +434,32 @@ namespace pksm
             return VersionTables::availableBalls(version());
         }
 
+        // Whether the sets above contain something, without their tree lookups
+        [[nodiscard]] bool isAvailable(int item) const
+        {
+            return VersionTables::isAvailable(version(), item);
+        }
+
+        [[nodiscard]] bool isAvailable(Move move) const
+        {
+            return VersionTables::isAvailable(version(), move);
+        }
+
+        [[nodiscard]] bool isAvailable(Species species) const
+        {
+            return VersionTables::isAvailable(version(), species);
+        }
+
+        [[nodiscard]] bool isAvailable(Ability ability) const
+        {
+            return VersionTables::isAvailable(version(), ability);
+        }
+
+        [[nodiscard]] bool isAvailable(Ball ball) const
+        {
+            return VersionTables::isAvailable(version(), ball);
+        }
+
         // Not guaranteed to be useful
         [[nodiscard]] int maxItem() const { return VersionTables::maxItem(version()); }
 
@@ -256,6 +487,16 @@ namespace pksm
         [[nodiscard]] u32 getEntireLengthIncludingFooter() const { return fullLength; }
 
         [[nodiscard]] const std::shared_ptr<u8[]>& rawData() const { return data; }
+
+    private:
+        template <typename Pkm>
+        [[nodiscard]] std::vector<SlotSummary> scanBoxesAs(void) const;
+
+        [[nodiscard]] DexSummary countDex(void) const;
+
+        // Rebuilt if the save's version changes, since that changes which species are counted
+        mutable std::optional<DexSummary> dexCache;
+        mutable GameVersion dexCacheVersion;
     };
 }
 
@@ -29,7 +29,9 @@
 
 #include "personal/personal.hpp"
 #include "sav/Sav.hpp"
+#include <algorithm>
 #include <array>
+#include <cstdio>
 
 namespace pksm
 {
@@ -44,13 +46,20 @@ namespace pksm
             OFS_MONEY, OFS_BADGES, OFS_TID, OFS_PC_ITEMS, OFS_CURRENT_BOX_INDEX, OFS_HOURS,
             OFS_PARTY, OFS_CURRENT_BOX, OFS_MAIN_DATA_SUM, OFS_BANK2_BOX_SUMS, OFS_BANK3_BOX_SUMS;
 
-        void fixBoxes(void);
+        void fixBoxes(void) override;
 
         [[nodiscard]] bool getCaught(Species species) const;
         void setCaught(Species species, bool caught);
         [[nodiscard]] bool getSeen(Species species) const;
         void setSeen(Species species, bool seen);
 
+        void writeDex(const PKX& pk) override;
+        [[nodiscard]] bool speciesSeen(Species species) const override { return getSeen(species); }
+        [[nodiscard]] bool speciesCaught(Species species) const override
+        {
+            return getCaught(species);
+        }
+
     public:
         Sav1(const std::shared_ptr<u8[]>& data, u32 length);
 
@@ -91,6 +100,7 @@ namespace pksm
         void language(Language v) override;
         [[nodiscard]] std::string otName(void) const override;
         void otName(const std::string_view& v) override;
+        size_t otName(char* out, size_t size) const override;
         [[nodiscard]] u32 money(void) const override;
         void money(u32 v) override;
 
@@ -136,10 +146,6 @@ namespace pksm
 
         [[nodiscard]] std::unique_ptr<PKX> emptyPkm(void) const override;
 
-        void dex(const PKX& pk) override;
-        [[nodiscard]] int dexSeen(void) const override;
-        [[nodiscard]] int dexCaught(void) const override;
-
         [[nodiscard]] int currentGiftAmount(void) const override { return 0; }
 
         void mysteryGift(const WCX&, int&) override {}
@@ -155,6 +161,12 @@ namespace pksm
 
         void boxName(u8 box, const std::string_view& name) override {}
 
+        size_t boxName(u8 box, char* out, size_t size) const override
+        {
+            int written = std::snprintf(out, size, "Box %d", box + 1);
+            return std::min<size_t>(written, size ? size - 1 : 0);
+        }
+
         [[nodiscard]] u8 boxWallpaper(u8 box) const override { return 0; }
 
         void boxWallpaper(u8 box, u8 v) override {}
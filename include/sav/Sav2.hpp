@@ -46,7 +46,7 @@ namespace pksm
             OFS_ITEMS, OFS_KEY_ITEMS, OFS_BALLS, OFS_CHECKSUM_ONE, OFS_MONEY, OFS_CHECKSUM_TWO,
             OFS_CHECKSUM_END, OFS_TIME_PLAYED, OFS_PALETTE, OFS_TID, OFS_NAME;
 
-        void fixBoxes(void);
+        void fixBoxes(void) override;
 
         [[nodiscard]] bool getCaught(Species species) const;
         void setCaught(Species species, bool caught);
@@ -57,6 +57,13 @@ namespace pksm
 
         std::span<const int> tmItems2() const;
 
+        void writeDex(const PKX& pk) override;
+        [[nodiscard]] bool speciesSeen(Species species) const override { return getSeen(species); }
+        [[nodiscard]] bool speciesCaught(Species species) const override
+        {
+            return getCaught(species);
+        }
+
     public:
         Sav2(const std::shared_ptr<u8[]>& data, u32 length,
             std::tuple<GameVersion, Language, bool> versionAndLanguage);
@@ -97,6 +104,7 @@ namespace pksm
         void language(Language v) override;
         [[nodiscard]] std::string otName(void) const override;
         void otName(const std::string_view& v) override;
+        size_t otName(char* out, size_t size) const override;
         [[nodiscard]] u32 money(void) const override;
         void money(u32 v) override;
 
@@ -142,10 +150,6 @@ namespace pksm
 
         [[nodiscard]] std::unique_ptr<PKX> emptyPkm(void) const override;
 
-        void dex(const PKX& pk) override;
-        [[nodiscard]] int dexSeen(void) const override;
-        [[nodiscard]] int dexCaught(void) const override;
-
         [[nodiscard]] int currentGiftAmount(void) const override { return 0; }
 
         void mysteryGift(const WCX&, int&) override {}
@@ -156,6 +160,7 @@ namespace pksm
 
         [[nodiscard]] std::string boxName(u8 box) const override;
         void boxName(u8 box, const std::string_view& name) override;
+        size_t boxName(u8 box, char* out, size_t size) const override;
 
         [[nodiscard]] u8 boxWallpaper(u8 box) const override { return 0; }
 
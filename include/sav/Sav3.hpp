@@ -30,6 +30,7 @@
 #include "personal/personal.hpp"
 #include "sav/Sav.hpp"
 #include <array>
+#include <bitset>
 
 namespace pksm
 {
@@ -79,6 +80,15 @@ namespace pksm
 
         int activeSAV;
 
+        // Sectors of the active save by position, then the two Hall of Fame sectors, whose
+        // checksums are out of date. The save counts as fully written when it's loaded
+        std::bitset<BLOCK_COUNT + 2> dirtySectors;
+        // Active save sectors that changed since they were last copied to the other save
+        std::bitset<BLOCK_COUNT> unmirroredSectors;
+        bool mirrorSlots = false;
+
+        void mirrorToOtherSlot(void);
+
         [[nodiscard]] u32 securityKey() const;
 
         [[nodiscard]] bool getEventFlag(int flagNumber) const;
@@ -98,17 +108,36 @@ namespace pksm
 
         Sav3(const std::shared_ptr<u8[]>& data, SmallVector<int, 3>&& seenFlagOffsets);
 
+        void writeDex(const PKX& pk) override;
+        [[nodiscard]] bool speciesSeen(Species species) const override { return getSeen(species); }
+        [[nodiscard]] bool speciesCaught(Species species) const override
+        {
+            return getCaught(species);
+        }
+
     public:
         static constexpr int SIZE_BLOCK = 0x1000;
         [[nodiscard]] static Game getVersion(const std::shared_ptr<u8[]>& dt);
 
+        // Only recomputes the checksums of sectors written since the last call. Writes through this
+        // class, getBlock() included, are tracked
         void resign(void);
+        void markDirty(u32 offset, size_t length = 1) override;
+
+        // Whether resign also copies the save to the other save slot, with a save counter one
+        // higher, so that both slots hold the edited save and the game loads that copy
+        void writeBothSlots(bool v) { mirrorSlots = v; }
 
         void finishEditing(void) override { resign(); }
 
         void beginEditing(void) override {}
 
-        [[nodiscard]] u8* getBlock(size_t blockNum) { return &data[blockOfs[blockNum]]; }
+        // Counts as writing to the block, since the block can be written through what's returned
+        [[nodiscard]] u8* getBlock(size_t blockNum)
+        {
+            markDirty(blockOfs[blockNum], SIZE_BLOCK_USED);
+            return &data[blockOfs[blockNum]];
+        }
 
         [[nodiscard]] u16 TID(void) const override;
         void TID(u16 v) override;
@@ -135,6 +164,7 @@ namespace pksm
         void language(Language v) override;
         [[nodiscard]] std::string otName(void) const override;
         void otName(const std::string_view& v) override;
+        size_t otName(char* out, size_t size) const override;
         [[nodiscard]] u32 money(void) const override;
         void money(u32 v) override;
         [[nodiscard]] u32 BP(void) const override;
@@ -175,10 +205,6 @@ namespace pksm
         void trade(PKX& pk, const Date& date = Date::today()) const override;
         [[nodiscard]] std::unique_ptr<PKX> emptyPkm() const override;
 
-        void dex(const PKX& pk) override;
-        [[nodiscard]] int dexSeen(void) const override;
-        [[nodiscard]] int dexCaught(void) const override;
-
         [[nodiscard]] int currentGiftAmount(void) const override { return 0; }
 
         void mysteryGift(const WCX&, int&) override {}
@@ -187,6 +213,7 @@ namespace pksm
         void cryptBoxData(bool crypted) override;
         [[nodiscard]] std::string boxName(u8 box) const override;
         void boxName(u8 box, const std::string_view& name) override;
+        size_t boxName(u8 box, char* out, size_t size) const override;
         [[nodiscard]] u8 boxWallpaper(u8 box) const override;
         void boxWallpaper(u8 box, u8 v) override;
         [[nodiscard]] u8 partyCount(void) const override;
@@ -38,6 +38,17 @@ namespace pksm
         int TrainerCard, Trainer2, PlayTime, LastViewedBox, PokeDexLanguageFlags, EncounterCount,
             PCLayout;
 
+        [[nodiscard]] u8* boxSlotData(u8 box, u8 slot) const override
+        {
+            return &data[boxOffset(box, slot)];
+        }
+
+        [[nodiscard]] u8* partySlotData(u8 slot) const override { return &data[partyOffset(slot)]; }
+
+        void writeDex(const PKX& pk) override;
+        [[nodiscard]] bool speciesSeen(Species species) const override;
+        [[nodiscard]] bool speciesCaught(Species species) const override;
+
     private:
         [[nodiscard]] int dexFormIndex(int species, int formct) const;
 
@@ -68,6 +79,7 @@ namespace pksm
         void language(Language v) override;
         [[nodiscard]] std::string otName(void) const override;
         void otName(const std::string_view& v) override;
+        size_t otName(char* out, size_t size) const override;
         [[nodiscard]] u32 money(void) const override;
         void money(u32 v) override;
         [[nodiscard]] u32 BP(void) const override;
@@ -102,15 +114,13 @@ namespace pksm
         void trade(PKX& pk, const Date& date = Date::today()) const override;
         [[nodiscard]] std::unique_ptr<PKX> emptyPkm() const override;
 
-        void dex(const PKX& pk) override;
-        [[nodiscard]] int dexSeen(void) const override;
-        [[nodiscard]] int dexCaught(void) const override;
         [[nodiscard]] int currentGiftAmount(void) const override;
         void mysteryGift(const WCX& wc, int& pos) override;
         [[nodiscard]] std::unique_ptr<WCX> mysteryGift(int pos) const override;
         void cryptBoxData(bool crypted) override;
         [[nodiscard]] std::string boxName(u8 box) const override;
         void boxName(u8 box, const std::string_view& name) override;
+        size_t boxName(u8 box, char* out, size_t size) const override;
         [[nodiscard]] u8 boxWallpaper(u8 box) const override;
         void boxWallpaper(u8 box, u8 v) override;
         [[nodiscard]] u8 partyCount(void) const override;
@@ -36,16 +36,46 @@ namespace pksm
     class Sav8 : public Sav
     {
     protected:
-        std::vector<std::shared_ptr<pksm::crypto::swsh::SCBlock>> blocks;
-
-        int Items, BoxLayout, Misc, TrainerCard, PlayTime, Status;
+        // Sorted by key. Blocks decrypt themselves on first access, so this is mutable to allow
+        // that from const accessors
+        mutable std::vector<pksm::crypto::swsh::SCBlock> blocks;
+        // Decrypted data of every block by index, once something has asked for it this editing
+        // session. finishEditing re-encrypts the blocks and clears this
+        mutable std::vector<u8*> decrypted;
+        size_t missingBlocks = 0;
 
         bool encrypted = false;
 
+        // Index of a block in blocks, looked up once so that accessors don't have to search for it
+        using BlockHandle = size_t;
+
+        // Looks up a block the accessors can't do without. Missing ones are counted in
+        // missingBlocks, and the handle returned for them must not be used
+        [[nodiscard]] BlockHandle requireBlock(u32 key);
+        // Looks up a block that only some revisions of the save have. Check the handle with
+        // hasBlock before using it
+        [[nodiscard]] BlockHandle optionalBlock(u32 key) const;
+
+        [[nodiscard]] bool hasBlock(BlockHandle block) const { return block < blocks.size(); }
+
+        [[nodiscard]] u8* blockData(BlockHandle block) const
+        {
+            if (!decrypted[block])
+            {
+                decrypted[block] = blocks[block].decryptedData();
+            }
+            return decrypted[block];
+        }
+
     public:
         Sav8(const std::shared_ptr<u8[]>& dt, size_t length);
 
-        [[nodiscard]] std::shared_ptr<pksm::crypto::swsh::SCBlock> getBlock(u32 key) const;
+        // Returns nullptr if no block with the given key exists
+        [[nodiscard]] pksm::crypto::swsh::SCBlock* getBlock(u32 key) const;
+
+        // Whether every block the accessors rely on exists. Sav::getSave doesn't return saves
+        // that fail this; anything constructing one directly has to check it before using it
+        [[nodiscard]] bool complete(void) const { return missingBlocks == 0; }
 
         void finishEditing(void) override;
         void beginEditing(void) override;
@@ -27,6 +27,7 @@
 #ifndef SAVB2W2_HPP
 #define SAVB2W2_HPP
 
+#include "sav/DirtyBlocks.hpp"
 #include "sav/Sav5.hpp"
 
 namespace pksm
@@ -73,10 +74,13 @@ namespace pksm
             0x25F78, 0x25F7A, 0x25F7C, 0x25F7E, 0x25F80, 0x25F82, 0x25F84, 0x25F86, 0x25F88,
             0x25F8A, 0x25F8C, 0x25F8E, 0x25F90, 0x25FA2};
 
+        DirtyBlocks dirtyBlocks{blockOfs, lengths};
+
     public:
         explicit SavB2W2(const std::shared_ptr<u8[]>& dt);
 
         void resign(void) override;
+        void markDirty(u32 offset, size_t length = 1) override { dirtyBlocks.mark(offset, length); }
 
         [[nodiscard]] SmallVector<std::pair<Pouch, std::span<const int>>, 15> validItems(
             void) const override;
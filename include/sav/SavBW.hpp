@@ -27,6 +27,7 @@
 #ifndef SAVBW_HPP
 #define SAVBW_HPP
 
+#include "sav/DirtyBlocks.hpp"
 #include "sav/Sav5.hpp"
 
 namespace pksm
@@ -72,10 +73,13 @@ namespace pksm
             0x23F78, 0x23F7A, 0x23F7C, 0x23F7E, 0x23F80, 0x23F82, 0x23F84, 0x23F86, 0x23F88,
             0x23F9A};
 
+        DirtyBlocks dirtyBlocks{blockOfs, lengths};
+
     public:
         explicit SavBW(const std::shared_ptr<u8[]>& dt);
 
         void resign(void) override;
+        void markDirty(u32 offset, size_t length = 1) override { dirtyBlocks.mark(offset, length); }
 
         [[nodiscard]] SmallVector<std::pair<Pouch, std::span<const int>>, 15> validItems(
             void) const override;
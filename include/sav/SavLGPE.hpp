@@ -28,6 +28,8 @@
 #define SAVLGPE_HPP
 
 #include "personal/personal.hpp"
+#include "sav/DexFormTable.hpp"
+#include "sav/DirtyBlocks.hpp"
 #include "sav/Sav.hpp"
 
 namespace pksm
@@ -46,6 +48,7 @@ namespace pksm
         static constexpr u16 formtable[62] = {3, 2, 6, 3, 9, 2, 15, 2, 18, 2, 19, 2, 20, 2, 26, 2,
             27, 2, 28, 2, 37, 2, 38, 2, 50, 2, 51, 2, 52, 2, 53, 2, 65, 2, 74, 2, 75, 2, 76, 2, 80,
             2, 88, 2, 89, 2, 94, 2, 103, 2, 105, 2, 115, 2, 127, 2, 130, 2, 142, 2, 150, 3};
+        static constexpr DexFormTable<809> dexForms{formtable};
 
         int dexFormIndex(int species, int formct, int start) const;
         int dexFormCount(int species) const;
@@ -53,9 +56,19 @@ namespace pksm
         void setDexFlags(int index, int gender, int shiny, int baseSpecies);
         bool sanitizeFormsToIterate(Species species, int& fs, int& fe, int formIn) const;
 
+        [[nodiscard]] u8* boxSlotData(u8 box, u8 slot) const override;
+        [[nodiscard]] u8* partySlotData(u8 slot) const override;
+
+        DirtyBlocks dirtyBlocks{chkofs, chklen};
+
+        void writeDex(const PKX& pk) override;
+        [[nodiscard]] bool speciesSeen(Species species) const override;
+        [[nodiscard]] bool speciesCaught(Species species) const override;
+
     public:
         SavLGPE(const std::shared_ptr<u8[]>& dt, size_t length);
         void resign(void);
+        void markDirty(u32 offset, size_t length = 1) override { dirtyBlocks.mark(offset, length); }
 
         void finishEditing(void) override { resign(); }
 
@@ -69,6 +82,7 @@ namespace pksm
         void partyBoxSlot(u8 slot, u16 v);
         void compressBox(void);
         void fixParty(void) override;
+        void fixBoxes(void) override;
 
         [[nodiscard]] u16 TID(void) const override;
         void TID(u16 v) override;
@@ -95,6 +109,7 @@ namespace pksm
         void language(Language v) override;
         [[nodiscard]] std::string otName(void) const override;
         void otName(const std::string_view& v) override;
+        size_t otName(char* out, size_t size) const override;
         [[nodiscard]] u32 money(void) const override;
         void money(u32 v) override;
 
@@ -136,10 +151,6 @@ namespace pksm
         void trade(PKX& pk, const Date& date = Date::today()) const override;
         [[nodiscard]] std::unique_ptr<PKX> emptyPkm() const override;
 
-        void dex(const PKX& pk) override;
-        [[nodiscard]] int dexSeen(void) const override;
-        [[nodiscard]] int dexCaught(void) const override;
-
         [[nodiscard]] int currentGiftAmount(void) const override { return 0; } // Data not stored
 
         void mysteryGift(const WCX& wc, int& pos) override;
@@ -154,6 +165,15 @@ namespace pksm
 
         void boxName(u8, const std::string_view&) override {}
 
+        size_t boxName(u8, char* out, size_t size) const override
+        {
+            if (size > 0)
+            {
+                out[0] = '\0';
+            }
+            return 0;
+        }
+
         [[nodiscard]] u8 boxWallpaper(u8) const override { return 0; }
 
         void boxWallpaper(u8, u8) override {}
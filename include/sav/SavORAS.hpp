@@ -27,6 +27,7 @@
 #ifndef SAVORAS_HPP
 #define SAVORAS_HPP
 
+#include "sav/DirtyBlocks.hpp"
 #include "sav/Sav6.hpp"
 
 namespace pksm
@@ -50,10 +51,13 @@ namespace pksm
             0x00400, 0x00618, 0x0025C, 0x00834, 0x00318, 0x007D0, 0x00C48, 0x00078, 0x00200,
             0x00C84, 0x00628, 0x00400, 0x07AD0, 0x078B0, 0x34AD0, 0x0E058};
 
+        DirtyBlocks dirtyBlocks{chkofs, chklen};
+
     public:
         explicit SavORAS(const std::shared_ptr<u8[]>& dt);
 
         void resign(void) override;
+        void markDirty(u32 offset, size_t length = 1) override { dirtyBlocks.mark(offset, length); }
 
         [[nodiscard]] SmallVector<std::pair<Pouch, std::span<const int>>, 15> validItems(
             void) const override;
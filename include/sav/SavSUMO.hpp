@@ -27,6 +27,8 @@
 #ifndef SAVSUMO_HPP
 #define SAVSUMO_HPP
 
+#include "sav/DexFormTable.hpp"
+#include "sav/DirtyBlocks.hpp"
 #include "sav/Sav7.hpp"
 
 namespace pksm
@@ -68,14 +70,18 @@ namespace pksm
             0x02D0, 0x0002, 0x02DF, 0x0002, 0x02E2, 0x0002, 0x02E5, 0x0004, 0x02E9, 0x0002, 0x02EA,
             0x0002, 0x02F2, 0x0002, 0x02F6, 0x0002, 0x0305, 0x0012, 0x0306, 0x000E, 0x030A, 0x0004,
             0x0310, 0x0002, 0x0321, 0x0002};
+        static constexpr DexFormTable<802> dexForms{formtable};
 
         int dexFormIndex(int species, int formct, int start) const override;
         int dexFormCount(int species) const override;
 
+        DirtyBlocks dirtyBlocks{chkofs, chklen};
+
     public:
         explicit SavSUMO(const std::shared_ptr<u8[]>& dt);
 
         void resign(void) override;
+        void markDirty(u32 offset, size_t length = 1) override { dirtyBlocks.mark(offset, length); }
 
         [[nodiscard]] SmallVector<std::pair<Pouch, std::span<const int>>, 15> validItems(
             void) const override;
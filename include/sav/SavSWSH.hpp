@@ -34,10 +34,38 @@ namespace pksm
     class SavSWSH : public Sav8
     {
     private:
-        int ArmorDex, CrownDex;
+        static constexpr u32 BOX_KEY         = 0x0d66012c;
+        static constexpr u32 PARTY_KEY       = 0x2985fe5d;
+        static constexpr u32 POKEDEX_KEY     = 0x4716c404;
+        static constexpr u32 ARMORDEX_KEY    = 0x3F936BA9;
+        static constexpr u32 CROWNDEX_KEY    = 0x3C9366F0;
+        static constexpr u32 ITEMS_KEY       = 0x1177c2c4;
+        static constexpr u32 BOXLAYOUT_KEY   = 0x19722c89;
+        static constexpr u32 MISC_KEY        = 0x1b882b09;
+        static constexpr u32 TRAINERCARD_KEY = 0x874da6fa;
+        static constexpr u32 PLAYTIME_KEY    = 0x8cbbfd90;
+        static constexpr u32 STATUS_KEY      = 0xf25c070e;
+        static constexpr u32 CURRENTBOX_KEY  = 0x017C3CBB;
+        static constexpr u32 WALLPAPER_KEY   = 0x2EB1B190;
+
+        BlockHandle boxBlock, partyBlock, dexBlock, armorDexBlock, crownDexBlock, itemBlock,
+            boxLayoutBlock, miscBlock, trainerCardBlock, playTimeBlock, statusBlock,
+            currentBoxBlock, wallpaperBlock;
         static constexpr std::array<u16, 25> gigaSpecies = {6, 12, 25, 52, 68, 94, 99, 131, 133,
             143, 569, 823, 826, 834, 839, 841, 842, 844, 851, 858, 861, 869, 879, 884, 890};
 
+        // The Galar dex entry for formSpecies, or its Isle of Armor or Crown Tundra one if it's
+        // only in those. nullptr if it's in none of them
+        [[nodiscard]] u8* dexEntry(u16 formSpecies) const;
+
+    protected:
+        [[nodiscard]] u8* boxSlotData(u8 box, u8 slot) const override;
+        [[nodiscard]] u8* partySlotData(u8 slot) const override;
+
+        void writeDex(const PKX& pk) override;
+        [[nodiscard]] bool speciesSeen(Species species) const override;
+        [[nodiscard]] bool speciesCaught(Species species) const override;
+
     public:
         static constexpr size_t SIZE_G8SWSH    = 0x1716B3; // 1.0
         static constexpr size_t SIZE_G8SWSH_1  = 0x17195E; // 1.0 -> 1.1
@@ -60,6 +88,7 @@ namespace pksm
         void gender(Gender v) override;
         [[nodiscard]] std::string otName(void) const override;
         void otName(const std::string_view& v) override;
+        size_t otName(char* out, size_t size) const override;
         [[nodiscard]] Language language(void) const override;
         void language(Language v) override;
         [[nodiscard]] std::string jerseyNum(void) const;
@@ -97,6 +126,7 @@ namespace pksm
 
         [[nodiscard]] std::string boxName(u8 box) const override;
         void boxName(u8 box, const std::string_view& name) override;
+        size_t boxName(u8 box, char* out, size_t size) const override;
         [[nodiscard]] u8 boxWallpaper(u8 box) const override;
         void boxWallpaper(u8 box, u8 v) override;
 
@@ -126,10 +156,6 @@ namespace pksm
 
         void cryptBoxData(bool crypted) override;
 
-        void dex(const PKX& pk) override;
-        [[nodiscard]] int dexSeen(void) const override;
-        [[nodiscard]] int dexCaught(void) const override;
-
         // Check whether gifts are stored, or whether some disgusting record system is used
         void mysteryGift(const WCX& wc, int& pos) override;
         [[nodiscard]] std::unique_ptr<WCX> mysteryGift(int) const override;
@@ -0,0 +1,83 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef SAVEBATCHLOADER_HPP
+#define SAVEBATCHLOADER_HPP
+
+#include "utils/coretypes.h"
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pksm
+{
+    class Sav;
+
+    // Runs Sav::getSave over many saves at once, spread across worker threads. Each worker
+    // claims the next unclaimed input as soon as it finishes one, so a few slow saves don't hold
+    // up the rest. i18n is still initialized lazily, by whichever worker needs it first. With
+    // _PKSMCORE_DISABLE_THREAD_SAFETY defined, everything is loaded on the calling thread instead
+    class SaveBatchLoader
+    {
+    public:
+        enum class Error
+        {
+            NONE,
+            // The file couldn't be opened or fully read
+            FILE_UNREADABLE,
+            // Sav::getSave didn't recognize the data
+            UNRECOGNIZED,
+            // Parsing the save threw; message holds what() of the exception, or a generic message
+            // if it wasn't a std::exception
+            PARSE_FAILED
+        };
+
+        struct Result
+        {
+            std::unique_ptr<Sav> save;
+            Error error = Error::NONE;
+            std::string message;
+        };
+
+        // threads of 0 uses one per hardware thread
+        explicit SaveBatchLoader(unsigned threads = 0);
+
+        // Results are in the same order as the inputs, one per input
+        [[nodiscard]] std::vector<Result> load(
+            const std::vector<std::pair<std::shared_ptr<u8[]>, size_t>>& buffers) const;
+        [[nodiscard]] std::vector<Result> load(const std::vector<std::string>& paths) const;
+
+    private:
+        template <typename Loader>
+        void run(size_t count, const Loader& loader) const;
+
+        // Unused with _PKSMCORE_DISABLE_THREAD_SAFETY
+        [[maybe_unused]] unsigned threads;
+    };
+}
+
+#endif
@@ -43,6 +43,13 @@ namespace pksm::VersionTables
     [[nodiscard]] const std::set<Ability>& availableAbilities(GameVersion version);
     [[nodiscard]] const std::set<Ball>& availableBalls(GameVersion version);
 
+    // Whether the sets above contain something, without their tree lookups
+    [[nodiscard]] bool isAvailable(GameVersion version, int item);
+    [[nodiscard]] bool isAvailable(GameVersion version, Move move);
+    [[nodiscard]] bool isAvailable(GameVersion version, Species species);
+    [[nodiscard]] bool isAvailable(GameVersion version, Ability ability);
+    [[nodiscard]] bool isAvailable(GameVersion version, Ball ball);
+
     // Not guaranteed to be useful
     [[nodiscard]] int maxItem(GameVersion version);
     [[nodiscard]] Move maxMove(GameVersion version);
@@ -28,10 +28,13 @@
 #define CRYPTO_HPP
 
 #include "utils/coretypes.h"
+#include "utils/endian.hpp"
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace pksm::crypto
@@ -45,7 +48,7 @@ namespace pksm::crypto
     [[nodiscard]] u32 sum32(std::span<const u8> data);
 
     // This SHA256 implementation is Brad Conte's. It has been modified to have a C++-style
-    // interface.
+    // interface. On x86 CPUs with the SHA extensions, blocks are hashed with those instead.
     class SHA256
     {
     private:
@@ -54,7 +57,8 @@ namespace pksm::crypto
         u64 bitLength;
         std::array<u32, 8> state;
 
-        void update();
+        // Hashes count consecutive 64-byte blocks
+        void transform(const u8* blocks, size_t count);
 
     public:
         SHA256() { reinitialize(); }
@@ -72,7 +76,12 @@ namespace pksm::crypto
     };
 
     [[nodiscard]] std::array<u8, 32> sha256(std::span<const u8> data);
+    // Hashes each buffer independently. On x86 CPUs with AVX2 but without the SHA extensions,
+    // eight buffers are hashed side by side
+    [[nodiscard]] std::vector<std::array<u8, 32>> sha256Batch(
+        std::span<const std::span<const u8>> buffers);
 
+    // Uses the x86 SHA extensions when they are available, like SHA256
     class SHA1
     {
     private:
@@ -81,7 +90,8 @@ namespace pksm::crypto
         u64 bitLength;
         std::array<u32, 5> state;
 
-        void update();
+        // Hashes count consecutive 64-byte blocks
+        void transform(const u8* blocks, size_t count);
 
     public:
         SHA1() { reinitialize(); }
@@ -98,13 +108,15 @@ namespace pksm::crypto
     };
 
     [[nodiscard]] std::array<u8, 20> sha1(std::span<const u8> data);
+    // Hashes each buffer independently, in the same way as sha256Batch
+    [[nodiscard]] std::vector<std::array<u8, 20>> sha1Batch(
+        std::span<const std::span<const u8>> buffers);
 
     namespace swsh
     {
         class SCBlock
         {
-            friend std::vector<std::shared_ptr<SCBlock>> getBlockList(
-                std::shared_ptr<u8[]> data, size_t length);
+            friend std::vector<SCBlock> getBlockList(std::shared_ptr<u8[]> data, size_t length);
 
         public:
             enum class SCBlockType : u8
@@ -130,7 +142,11 @@ namespace pksm::crypto
                 Float  = 16,
                 Double = 17,
             };
-            u32 key() const;
+            SCBlock(SCBlock&&)            = default;
+            SCBlock& operator=(SCBlock&&) = default;
+
+            u32 key() const { return blockKey; }
+
             // Nop if in proper state
             void encrypt();
             void decrypt();
@@ -155,10 +171,13 @@ namespace pksm::crypto
             // myOffset) == key
             std::shared_ptr<u8[]> data = nullptr;
             size_t myOffset;
-            size_t dataLength;
+            size_t dataLength = 0;
+            u32 blockKey;
             SCBlockType type;
-            SCBlockType subtype;
-            bool currentlyEncrypted = false;
+            SCBlockType subtype = SCBlockType::None;
+            // Blocks are only parsed for their headers on load; the payload is left encrypted in
+            // the save until it is first requested
+            bool currentlyEncrypted = true;
 
             size_t encryptedDataSize();
             static size_t arrayEntrySize(SCBlockType type);
@@ -168,8 +187,11 @@ namespace pksm::crypto
         void applyXor(std::shared_ptr<u8[]> data, size_t length);
         void sign(std::shared_ptr<u8[]> data, size_t length);
         [[nodiscard]] bool verify(std::shared_ptr<u8[]> data, size_t length);
-        [[nodiscard]] std::vector<std::shared_ptr<SCBlock>> getBlockList(
-            std::shared_ptr<u8[]> data, size_t length);
+        // Equivalent to applyXor followed by sign, but only makes one pass over the data
+        void applyXorAndSign(std::shared_ptr<u8[]> data, size_t length);
+        // Builds a key-sorted index of every block in an unpadded save. Only block headers are
+        // read; no data is decrypted until a block's decryptedData() is requested
+        [[nodiscard]] std::vector<SCBlock> getBlockList(std::shared_ptr<u8[]> data, size_t length);
     }
 
     namespace pkm
@@ -194,6 +216,67 @@ namespace pksm::crypto
             return seed * 0x41C64E6D + 0x6073;
         }
 
+        // Returns the multiplier and increment that advance the seed by the given number of steps
+        // at once, so that seedStep(seed, n) == seed * mult + add
+        [[nodiscard]] constexpr std::pair<u32, u32> seedJump(u32 steps)
+        {
+            u32 mult = 1, add = 0;
+            u32 stepMult = 0x41C64E6D, stepAdd = 0x6073;
+            while (steps != 0)
+            {
+                if (steps & 1)
+                {
+                    mult = mult * stepMult;
+                    add  = add * stepMult + stepAdd;
+                }
+                stepAdd  = stepAdd * stepMult + stepAdd;
+                stepMult = stepMult * stepMult;
+                steps    >>= 1;
+            }
+            return {mult, add};
+        }
+
+        [[nodiscard]] constexpr u32 seedStep(u32 seed, u32 steps)
+        {
+            auto [mult, add] = seedJump(steps);
+            return seed * mult + add;
+        }
+
+        namespace internal
+        {
+            // Runs several interleaved copies of the LCG, each jumping ahead by the number of
+            // copies per step, so that they're independent of each other and can be vectorized
+            constexpr void crypt(u8* data, size_t size, u32 key)
+            {
+                constexpr size_t Lanes                 = 8;
+                constexpr std::pair<u32, u32> laneJump = seedJump(Lanes);
+                std::array<u32, Lanes> seeds           = {};
+                for (size_t lane = 0; lane < Lanes; lane++)
+                {
+                    key         = seedStep(key);
+                    seeds[lane] = key;
+                }
+
+                size_t i = 0;
+                for (; i + 2 * Lanes <= size; i += 2 * Lanes)
+                {
+                    for (size_t lane = 0; lane < Lanes; lane++)
+                    {
+                        u8* word = data + i + 2 * lane;
+                        LittleEndian::convertFrom<u16>(
+                            word, LittleEndian::convertTo<u16>(word) ^ u16(seeds[lane] >> 16));
+                        seeds[lane] = seeds[lane] * laneJump.first + laneJump.second;
+                    }
+                }
+
+                for (size_t lane = 0; i < size; i += 2, lane++)
+                {
+                    data[i]     ^= (seeds[lane] >> 16);
+                    data[i + 1] ^= (seeds[lane] >> 24);
+                }
+            }
+        }
+
         template <size_t BlockLength>
         constexpr void blockShuffle(u8* data, u8 sv)
         {
@@ -211,23 +294,35 @@ namespace pksm::crypto
         template <size_t Size>
         constexpr void crypt(u8* data, u32 key)
         {
-            for (size_t i = 0; i < Size; i += 2)
+            internal::crypt(data, Size, key);
+        }
+
+        // Crypts data as though it started offset bytes into a region crypted with key, which
+        // allows decrypting only part of a region. offset must be even
+        constexpr void crypt(std::span<u8> data, u32 key, size_t offset)
+        {
+            internal::crypt(data.data(), data.size(), seedStep(key, offset / 2));
+        }
+
+        // Decrypts only blocks [first, last) of data, which is shuffled with sv and encrypted with
+        // key, and writes them where they'd be after unshuffling to out
+        template <size_t BlockLength>
+        constexpr void decryptBlocks(
+            const u8* data, u8* out, u32 key, u8 sv, size_t first, size_t last)
+        {
+            for (size_t block = first; block < last; block++)
             {
-                key         = seedStep(key);
-                data[i]     ^= (key >> 16);
-                data[i + 1] ^= (key >> 24);
+                const size_t ofs = BlockPositions[sv * 4 + block] * BlockLength;
+                u8* dest         = out + block * BlockLength;
+                std::copy(data + ofs, data + ofs + BlockLength, dest);
+                crypt(std::span{dest, BlockLength}, key, ofs);
             }
         }
 
         [[deprecated("Use the templated version wherever possible")]] constexpr void crypt(
             std::span<u8> data, u32 key)
         {
-            for (size_t i = 0; i < data.size(); i += 2)
-            {
-                key         = seedStep(key);
-                data[i]     ^= (key >> 16);
-                data[i + 1] ^= (key >> 24);
-            }
+            internal::crypt(data.data(), data.size(), key);
         }
     }
 }
@@ -27,11 +27,20 @@
 #ifndef IO_HPP
 #define IO_HPP
 
+#include "utils/coretypes.h"
+#include <cstddef>
+#include <memory>
 #include <string>
 
 namespace io
 {
     [[nodiscard]] bool exists(const std::string& name);
+    // Reads the whole file into a new buffer and stores its size. Returns nullptr if it can't be
+    // read or is empty
+    [[nodiscard]] std::shared_ptr<u8[]> read(const std::string& name, size_t& size);
+    // Stores when the file was last modified, in seconds since the epoch. Returns false if it
+    // doesn't exist
+    [[nodiscard]] bool modified(const std::string& name, s64& time);
 }
 
 #endif
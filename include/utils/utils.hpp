@@ -35,6 +35,7 @@
 #include <locale>
 #include <memory>
 #include <optional>
+#include <span>
 #include <stdarg.h>
 #include <string.h>
 #include <string>
@@ -131,6 +132,21 @@ namespace StringUtils
     void setString2(u8* data, const std::string_view& v, int ofs, int len, pksm::Language lang,
         int padTo = 0, u8 padWith = 0x50);
 
+    // Overloads of the above that write UTF-8 into out instead of allocating a std::string. out is
+    // always null-terminated if it isn't empty, and the length before the terminator is returned.
+    // Whatever doesn't fit is cut off, never partway through a codepoint. getString and getString4
+    // also take one of the in-place transString45 or transString67 overloads to apply first, so
+    // that transString45(getString4(...)) and the like don't need any allocations either
+    size_t getString(const u8* data, int ofs, int len, std::span<char> out,
+        char16_t term = u'\0', void (*trans)(char16_t*, size_t) = nullptr);
+    size_t getString4(const u8* data, int ofs, int len, std::span<char> out,
+        void (*trans)(char16_t*, size_t) = nullptr);
+    size_t getString3(const u8* data, int ofs, int len, bool jp, std::span<char> out);
+    size_t getString1(const u8* data, int ofs, int len, pksm::Language lang, std::span<char> out,
+        bool transporter = false);
+    size_t getString2(const u8* data, int ofs, int len, pksm::Language lang, std::span<char> out,
+        bool transporter = false);
+
     void gbStringFailsafe(u8* data, int ofs, int len);
 
     std::string getTradeOT(pksm::Language lang);
@@ -161,6 +177,9 @@ namespace StringUtils
      */
     [[nodiscard]] std::string transString67(const std::string_view& str);
     [[nodiscard]] std::u16string transString67(const std::u16string_view& str);
+    // In-place versions of the above, for UTF-16 buffers
+    void transString45(char16_t* str, size_t length);
+    void transString67(char16_t* str, size_t length);
 
     namespace internal
     {
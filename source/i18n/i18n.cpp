@@ -93,6 +93,15 @@ namespace i18n
             {
                 callback(lang);
             }
+            releaseStringTable(lang);
+            // findLines may have loaded the English table to fall back on. Nothing needs it once
+            // this is done unless English is being initialized at the same time, and at worst
+            // that reloads it
+            if (lang != pksm::Language::ENG &&
+                languages.find(pksm::Language::ENG)->second != LangState::INITIALIZING)
+            {
+                releaseStringTable(pksm::Language::ENG);
+            }
             found->second = LangState::INITIALIZED;
 #ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
             found->second.notify_all();
@@ -154,6 +163,16 @@ namespace i18n
 
     void load(pksm::Language lang, const std::string& name, std::vector<std::string>& array)
     {
+        if (auto [table, lines] = findLines(lang, name); table)
+        {
+            array.reserve(array.size() + lines.count);
+            for (u32 i = lines.first; i < lines.first + lines.count; i++)
+            {
+                array.emplace_back(table->line(i));
+            }
+            return;
+        }
+
         std::string path = io::exists(_PKSMCORE_LANG_FOLDER + folder(lang) + name)
                              ? _PKSMCORE_LANG_FOLDER + folder(lang) + name
                              : _PKSMCORE_LANG_FOLDER + folder(pksm::Language::ENG) + name;
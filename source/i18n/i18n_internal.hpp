@@ -33,7 +33,11 @@
 #include "utils/i18n.hpp"
 #include "utils/io.hpp"
 #include <atomic>
+#include <cstdlib>
 #include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
 #include <time.h>
 #include <unordered_map>
 
@@ -94,11 +98,76 @@ namespace i18n
 
     std::string folder(pksm::Language lang);
 
+    // Every strings file of one language packed into a single blob, so that a language can be
+    // loaded with one read instead of opening each file. Made from the text files by
+    // tools/pack_strings.py, which describes the format
+    class StringTable
+    {
+    public:
+        static constexpr u32 VERSION = 2;
+
+        // The lines of one of the packed files
+        struct Lines
+        {
+            u32 first;
+            u32 count;
+        };
+
+        // Returns null if the file can't be read or isn't a valid table
+        [[nodiscard]] static std::unique_ptr<StringTable> fromFile(const std::string& path);
+
+        // Whether every text file the table was packed from is still in folder and hasn't been
+        // modified since
+        [[nodiscard]] bool upToDate(const std::string& folder) const;
+
+        // name is the path load() is given, such as "/species.txt"
+        [[nodiscard]] std::optional<Lines> find(std::string_view name) const;
+        // Null-terminated, without the line ending
+        [[nodiscard]] std::string_view line(u32 index) const;
+
+    private:
+        StringTable(
+            std::unique_ptr<u8[]> data, u32 fileCount, u32 lineCount, s64 newestModified);
+
+        [[nodiscard]] u32 offset(u32 index) const;
+
+        std::unique_ptr<u8[]> data;
+        u32 fileCount;
+        u32 lineCount;
+        s64 newestModified;
+    };
+
+    // Finds name in the packed table for lang, or in the English one if lang's doesn't have it,
+    // the same way the text files fall back to English. The table is null if load() should read
+    // the text files instead, which includes when a table is out of date or lang has a text file
+    // its table doesn't
+    [[nodiscard]] std::pair<std::shared_ptr<const StringTable>, StringTable::Lines> findLines(
+        pksm::Language lang, std::string_view name);
+    // Called once lang is initialized, as its table is no longer needed. The English table is
+    // released then too, in case findLines loaded it as a fallback
+    void releaseStringTable(pksm::Language lang);
+
     void load(pksm::Language lang, const std::string& name, std::vector<std::string>& array);
 
     template <std::integral T>
     void load(pksm::Language lang, const std::string& name, std::map<T, std::string>& map)
     {
+        if (auto [table, lines] = findLines(lang, name); table)
+        {
+            for (u32 i = lines.first; i < lines.first + lines.count; i++)
+            {
+                std::string_view line = table->line(i);
+                // Lines are null-terminated, so this stops at the '|'
+                T val = std::strtoll(line.data(), nullptr, 0);
+                if (size_t sep = line.find('|'); sep != std::string_view::npos)
+                {
+                    line.remove_prefix(sep + 1);
+                }
+                map[val] = std::string(line);
+            }
+            return;
+        }
+
         std::string path = io::exists(_PKSMCORE_LANG_FOLDER + folder(lang) + name)
                              ? _PKSMCORE_LANG_FOLDER + folder(lang) + name
                              : _PKSMCORE_LANG_FOLDER + folder(pksm::Language::ENG) + name;
@@ -0,0 +1,243 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "i18n_internal.hpp"
+#include "utils/endian.hpp"
+#include <cstdio>
+#include <cstring>
+
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+#include <mutex>
+#endif
+
+namespace i18n
+{
+    namespace
+    {
+        constexpr size_t HEADER_SIZE = 0x18;
+        constexpr size_t FILE_SIZE   = 0xC;
+
+        // Tables that have been looked for, by language. Null if there was no valid one
+        std::unordered_map<pksm::Language, std::shared_ptr<const StringTable>> tables;
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+        std::mutex tablesMutex;
+#endif
+
+        std::shared_ptr<const StringTable> stringTable(pksm::Language lang)
+        {
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+            std::lock_guard lock{tablesMutex};
+#endif
+            auto found = tables.find(lang);
+            if (found == tables.end())
+            {
+                const std::string path = _PKSMCORE_LANG_FOLDER + folder(lang);
+                std::shared_ptr<const StringTable> table = StringTable::fromFile(path + ".bin");
+                if (table && !table->upToDate(path))
+                {
+                    table = nullptr;
+                }
+                found = tables.emplace(lang, std::move(table)).first;
+            }
+            return found->second;
+        }
+    }
+
+    StringTable::StringTable(
+        std::unique_ptr<u8[]> data, u32 fileCount, u32 lineCount, s64 newestModified)
+        : data(std::move(data)),
+          fileCount(fileCount),
+          lineCount(lineCount),
+          newestModified(newestModified)
+    {
+    }
+
+    std::unique_ptr<StringTable> StringTable::fromFile(const std::string& path)
+    {
+        FILE* file = fopen(path.c_str(), "rb");
+        if (!file)
+        {
+            return nullptr;
+        }
+
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        rewind(file);
+
+        std::unique_ptr<u8[]> data;
+        if (size >= long(HEADER_SIZE))
+        {
+            data = std::unique_ptr<u8[]>{new u8[size]};
+            if (fread(data.get(), 1, size, file) != size_t(size))
+            {
+                data = nullptr;
+            }
+        }
+        fclose(file);
+
+        if (!data || std::memcmp(data.get(), "PKST", 4) != 0 ||
+            LittleEndian::convertTo<u32>(data.get() + 0x4) != VERSION)
+        {
+            return nullptr;
+        }
+
+        // Everything is checked here so that nothing has to be checked when reading
+        u32 fileCount  = LittleEndian::convertTo<u32>(data.get() + 0x8);
+        u32 lineCount  = LittleEndian::convertTo<u32>(data.get() + 0xC);
+        s64 modified   = LittleEndian::convertTo<s64>(data.get() + 0x10);
+        u64 offsetsEnd = HEADER_SIZE + u64(fileCount) * FILE_SIZE + (u64(lineCount) + 1) * 4;
+        if (offsetsEnd > u64(size))
+        {
+            return nullptr;
+        }
+
+        std::unique_ptr<StringTable> ret{
+            new StringTable(std::move(data), fileCount, lineCount, modified)};
+        if (ret->offset(0) < offsetsEnd || ret->offset(lineCount) > u64(size))
+        {
+            return nullptr;
+        }
+        for (u32 i = 0; i < lineCount; i++)
+        {
+            u32 end = ret->offset(i + 1);
+            if (end <= ret->offset(i) || ret->data[end - 1] != '\0')
+            {
+                return nullptr;
+            }
+        }
+
+        for (u32 i = 0; i < fileCount; i++)
+        {
+            const u8* entry = ret->data.get() + HEADER_SIZE + i * FILE_SIZE;
+            u32 name        = LittleEndian::convertTo<u32>(entry);
+            u32 first       = LittleEndian::convertTo<u32>(entry + 0x4);
+            u32 count       = LittleEndian::convertTo<u32>(entry + 0x8);
+            if (name >= lineCount || u64(first) + count > lineCount)
+            {
+                return nullptr;
+            }
+            // find() is a binary search
+            if (i > 0 &&
+                ret->line(LittleEndian::convertTo<u32>(entry - FILE_SIZE)) >= ret->line(name))
+            {
+                return nullptr;
+            }
+        }
+
+        return ret;
+    }
+
+    bool StringTable::upToDate(const std::string& folder) const
+    {
+        // Only the files are looked at, not their contents, which would defeat the point
+        for (u32 i = 0; i < fileCount; i++)
+        {
+            const u8* entry = data.get() + HEADER_SIZE + i * FILE_SIZE;
+            s64 modified;
+            if (!io::modified(folder + std::string(line(LittleEndian::convertTo<u32>(entry))),
+                    modified) ||
+                modified > newestModified)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    u32 StringTable::offset(u32 index) const
+    {
+        return LittleEndian::convertTo<u32>(
+            data.get() + HEADER_SIZE + fileCount * FILE_SIZE + index * 4);
+    }
+
+    std::string_view StringTable::line(u32 index) const
+    {
+        u32 start = offset(index);
+        return std::string_view((const char*)data.get() + start, offset(index + 1) - start - 1);
+    }
+
+    std::optional<StringTable::Lines> StringTable::find(std::string_view name) const
+    {
+        u32 low  = 0;
+        u32 high = fileCount;
+        while (low < high)
+        {
+            u32 mid         = low + (high - low) / 2;
+            const u8* entry = data.get() + HEADER_SIZE + mid * FILE_SIZE;
+            auto compare    = line(LittleEndian::convertTo<u32>(entry)).compare(name);
+            if (compare == 0)
+            {
+                return Lines{LittleEndian::convertTo<u32>(entry + 0x4),
+                    LittleEndian::convertTo<u32>(entry + 0x8)};
+            }
+            else if (compare < 0)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::pair<std::shared_ptr<const StringTable>, StringTable::Lines> findLines(
+        pksm::Language lang, std::string_view name)
+    {
+        std::shared_ptr<const StringTable> table = stringTable(lang);
+        if (table)
+        {
+            std::optional<StringTable::Lines> lines = table->find(name);
+            if (!lines && lang != pksm::Language::ENG)
+            {
+                // A file added since the table was packed
+                if (io::exists(_PKSMCORE_LANG_FOLDER + folder(lang) + std::string(name)))
+                {
+                    return {nullptr, {}};
+                }
+                table = stringTable(pksm::Language::ENG);
+                if (table)
+                {
+                    lines = table->find(name);
+                }
+            }
+            if (lines)
+            {
+                return {table, *lines};
+            }
+        }
+        return {nullptr, {}};
+    }
+
+    void releaseStringTable(pksm::Language lang)
+    {
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+        std::lock_guard lock{tablesMutex};
+#endif
+        tables.erase(lang);
+    }
+}
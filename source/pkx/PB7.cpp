@@ -36,17 +36,8 @@ namespace pksm
     {
         if (!isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
             refreshChecksum();
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
-                data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
-            }
+            encrypt(data, isParty());
         }
     }
 
@@ -54,24 +45,71 @@ namespace pksm
     {
         if (isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
+            decrypt(data, isParty());
+        }
+    }
+
+    bool PB7::isEncrypted() const
+    {
+        return isEncrypted(data);
+    }
+
+    void PB7::cryptBoxData(u8* data, size_t count, bool party, bool crypted)
+    {
+        const size_t length = party ? PARTY_LENGTH : BOX_LENGTH;
+        for (u8* pkm = data; pkm != data + count * length; pkm += length)
+        {
+            if (isEncrypted(pkm))
             {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
+                decrypt(pkm, party);
+            }
+            if (!crypted && !isEncrypted(pkm))
+            {
+                LittleEndian::convertFrom<u16>(pkm + 0x06, calcChecksum(pkm));
+                encrypt(pkm, party);
             }
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
         }
     }
 
-    bool PB7::isEncrypted() const
+    void PB7::encrypt(u8* data, bool party)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(data);
+        u8 sv  = (ec >> 13) & 31;
+        pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
+            data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
+        pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(data + ENCRYPTION_START, ec);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, ec);
+        }
+    }
+
+    void PB7::decrypt(u8* data, bool party)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(data);
+        u8 sv  = (ec >> 13) & 31;
+        pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(data + ENCRYPTION_START, ec);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, ec);
+        }
+        pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+    }
+
+    bool PB7::isEncrypted(const u8* data)
     {
         return LittleEndian::convertTo<u16>(data + 0xC8) != 0 &&
                LittleEndian::convertTo<u16>(data + 0x58) != 0;
     }
 
+    void PB7::decryptBlocks(const u8* data, u8* out, size_t first, size_t last)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(data);
+        std::copy(data, data + ENCRYPTION_START, out);
+        pksm::crypto::pkm::decryptBlocks<BLOCK_LENGTH>(
+            data + ENCRYPTION_START, out + ENCRYPTION_START, ec, (ec >> 13) & 31, first, last);
+    }
+
     PB7::PB7(PrivateConstructor, u8* dt, bool party, bool direct)
         : PKX(dt, party ? PARTY_LENGTH : BOX_LENGTH, direct)
     {
@@ -337,6 +375,11 @@ namespace pksm
         return StringUtils::getString(data, 0x40, 12);
     }
 
+    size_t PB7::nickname(char* out, size_t size) const
+    {
+        return StringUtils::getString(data, 0x40, 12, {out, size});
+    }
+
     void PB7::nickname(const std::string_view& v)
     {
         StringUtils::setString(data, v, 0x40, 12);
@@ -523,6 +566,11 @@ namespace pksm
         return StringUtils::getString(data, 0xB0, 12);
     }
 
+    size_t PB7::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString(data, 0xB0, 12, {out, size});
+    }
+
     void PB7::otName(const std::string_view& v)
     {
         StringUtils::setString(data, v, 0xB0, 12);
@@ -681,13 +729,18 @@ namespace pksm
     }
 
     void PB7::refreshChecksum(void)
+    {
+        checksum(calcChecksum(data));
+    }
+
+    u16 PB7::calcChecksum(const u8* data)
     {
         u16 chk = 0;
-        for (u8 i = 8; i < 232; i += 2)
+        for (size_t i = 8; i < BOX_LENGTH; i += 2)
         {
             chk += LittleEndian::convertTo<u16>(data + i);
         }
-        checksum(chk);
+        return chk;
     }
 
     Type PB7::hpType(void) const
@@ -743,13 +796,7 @@ namespace pksm
 
     u8 PB7::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExp(experience(), expType());
     }
 
     void PB7::level(u8 v)
@@ -968,62 +1015,65 @@ namespace pksm
     std::unique_ptr<PK8> PB7::convertToG8(Sav& save) const
     {
         auto pk8 = PKX::getPKM<Generation::EIGHT>(nullptr, PK8::BOX_LENGTH);
+        convertToG8(*pk8, save);
+        return pk8;
+    }
 
+    void PB7::convertToG8(PK8& pk8, Sav& save) const
+    {
         // Note: Locale stuff does not transfer
-        pk8->encryptionConstant(encryptionConstant());
-        pk8->species(species());
-        pk8->TID(TID());
-        pk8->SID(SID());
-        pk8->experience(experience());
-        pk8->PID(PID());
+        pk8.encryptionConstant(encryptionConstant());
+        pk8.species(species());
+        pk8.TID(TID());
+        pk8.SID(SID());
+        pk8.experience(experience());
+        pk8.PID(PID());
         if (ability() == PersonalLGPE::ability(formSpecies(), abilityNumber() >> 1))
         {
-            pk8->setAbility(abilityNumber() >> 1);
+            pk8.setAbility(abilityNumber() >> 1);
         }
         else
         {
-            pk8->ability(ability());
-            pk8->abilityNumber(abilityNumber());
+            pk8.ability(ability());
+            pk8.abilityNumber(abilityNumber());
         }
-        pk8->language(language());
+        pk8.language(language());
         for (Stat stat : {Stat::HP, Stat::ATK, Stat::DEF, Stat::SPATK, Stat::SPDEF, Stat::SPD})
         {
-            pk8->ev(stat, ev(stat));
-            pk8->iv(stat, iv(stat));
-            pk8->hyperTrain(stat, hyperTrain(stat));
+            pk8.ev(stat, ev(stat));
+            pk8.iv(stat, iv(stat));
+            pk8.hyperTrain(stat, hyperTrain(stat));
         }
         for (size_t i = 0; i < 4; i++)
         {
-            pk8->move(i, move(i));
-            pk8->PPUp(i, PPUp(i));
-            pk8->PP(i, PP(i));
-            pk8->relearnMove(i, move(i));
+            pk8.move(i, move(i));
+            pk8.PPUp(i, PPUp(i));
+            pk8.PP(i, PP(i));
+            pk8.relearnMove(i, move(i));
         }
-        pk8->nicknamed(nicknamed());
-        pk8->fatefulEncounter(fatefulEncounter());
-        pk8->gender(gender());
-        pk8->alternativeForm(alternativeForm());
-        pk8->nature(nature());
-        pk8->nickname(nickname());
-        pk8->version(version());
-        pk8->otName(otName());
-        pk8->metDate(metDate());
-        pk8->otGender(otGender());
-        pk8->metLocation(metLocation());
-        pk8->ball(ball());
-        pk8->metLevel(metLevel());
-
-        pk8->pkrsStrain(pkrsStrain());
-        pk8->pkrsDays(pkrsDays());
-
-        pk8->otFriendship(otFriendship());
-        pk8->origNature(nature());
-
-        pk8->height(height());
-        pk8->weight(weight());
-
-        pk8->refreshChecksum();
-
-        return pk8;
+        pk8.nicknamed(nicknamed());
+        pk8.fatefulEncounter(fatefulEncounter());
+        pk8.gender(gender());
+        pk8.alternativeForm(alternativeForm());
+        pk8.nature(nature());
+        pk8.nickname(nickname());
+        pk8.version(version());
+        pk8.otName(otName());
+        pk8.metDate(metDate());
+        pk8.otGender(otGender());
+        pk8.metLocation(metLocation());
+        pk8.ball(ball());
+        pk8.metLevel(metLevel());
+
+        pk8.pkrsStrain(pkrsStrain());
+        pk8.pkrsDays(pkrsDays());
+
+        pk8.otFriendship(otFriendship());
+        pk8.origNature(nature());
+
+        pk8.height(height());
+        pk8.weight(weight());
+
+        pk8.refreshChecksum();
     }
 }
@@ -152,49 +152,54 @@ namespace pksm
     std::unique_ptr<PK7> PK2::convertToG7(Sav& save) const
     {
         auto pk7 = PKX::getPKM<Generation::SEVEN>(nullptr, PK7::BOX_LENGTH);
+        convertToG7(*pk7, save);
+        return pk7;
+    }
 
-        pk7->encryptionConstant(randomNumber(0, 0xFFFFFFFF));
-        pk7->PID(randomNumber(0, 0xFFFFFFFF));
-        pk7->species(species());
-        pk7->TID(TID());
-        pk7->level(level());
-        pk7->metLevel(level());
-        pk7->nature(nature());
-        pk7->ball(ball());
-        pk7->metDate(Date::today());
-        pk7->version(version());
+    void PK2::convertToG7(PK7& pk7, Sav& save) const
+    {
+        pk7.encryptionConstant(randomNumber(0, 0xFFFFFFFF));
+        pk7.PID(randomNumber(0, 0xFFFFFFFF));
+        pk7.species(species());
+        pk7.TID(TID());
+        pk7.level(level());
+        pk7.metLevel(level());
+        pk7.nature(nature());
+        pk7.ball(ball());
+        pk7.metDate(Date::today());
+        pk7.version(version());
 
         // cannot transfer Dizzy Punch
-        pk7->move(0, move(0) == Move::DizzyPunch ? Move::None : move(0));
-        pk7->move(1, move(1) == Move::DizzyPunch ? Move::None : move(1));
-        pk7->move(2, move(2) == Move::DizzyPunch ? Move::None : move(2));
-        pk7->move(3, move(3) == Move::DizzyPunch ? Move::None : move(3));
-        pk7->PPUp(0, PPUp(0));
-        pk7->PPUp(1, PPUp(1));
-        pk7->PPUp(2, PPUp(2));
-        pk7->PPUp(3, PPUp(3));
-
-        pk7->metLocation(0x7541);
-        pk7->gender(gender());
-        pk7->nicknamed(false);
-        pk7->alternativeForm(alternativeForm());
-
-        pk7->currentHandler(PKXHandler::NonOT);
-        pk7->htName(save.otName());
-        pk7->htGender(save.gender());
-
-        pk7->consoleRegion(save.consoleRegion());
-        pk7->country(save.country());
-        pk7->region(save.subRegion());
-        pk7->geoCountry(0, save.country());
-        pk7->geoRegion(0, save.subRegion());
-
-        pk7->healPP();
-        pk7->language(save.language());
-        pk7->nickname(species().localize(pk7->language()));
-
-        pk7->otFriendship(PersonalSMUSUM::baseFriendship(u16(species())));
-        pk7->htFriendship(pk7->otFriendship());
+        pk7.move(0, move(0) == Move::DizzyPunch ? Move::None : move(0));
+        pk7.move(1, move(1) == Move::DizzyPunch ? Move::None : move(1));
+        pk7.move(2, move(2) == Move::DizzyPunch ? Move::None : move(2));
+        pk7.move(3, move(3) == Move::DizzyPunch ? Move::None : move(3));
+        pk7.PPUp(0, PPUp(0));
+        pk7.PPUp(1, PPUp(1));
+        pk7.PPUp(2, PPUp(2));
+        pk7.PPUp(3, PPUp(3));
+
+        pk7.metLocation(0x7541);
+        pk7.gender(gender());
+        pk7.nicknamed(false);
+        pk7.alternativeForm(alternativeForm());
+
+        pk7.currentHandler(PKXHandler::NonOT);
+        pk7.htName(save.otName());
+        pk7.htGender(save.gender());
+
+        pk7.consoleRegion(save.consoleRegion());
+        pk7.country(save.country());
+        pk7.region(save.subRegion());
+        pk7.geoCountry(0, save.country());
+        pk7.geoRegion(0, save.subRegion());
+
+        pk7.healPP();
+        pk7.language(save.language());
+        pk7.nickname(species().localize(pk7.language()));
+
+        pk7.otFriendship(PersonalSMUSUM::baseFriendship(u16(species())));
+        pk7.htFriendship(pk7.otFriendship());
 
         std::array<Stat, 6> stats = {
             Stat::HP, Stat::ATK, Stat::DEF, Stat::SPD, Stat::SPATK, Stat::SPDEF};
@@ -208,20 +213,20 @@ namespace pksm
 
         for (const auto& s : stats | std::views::take(perfectStats))
         {
-            pk7->iv(s, 31);
+            pk7.iv(s, 31);
         }
         for (const auto& s : stats | std::views::drop(perfectStats))
         {
-            pk7->iv(s, randomNumber(0, 31));
+            pk7.iv(s, randomNumber(0, 31));
         }
 
-        if (pk7->shiny() && !shiny())
+        if (pk7.shiny() && !shiny())
         {
-            pk7->PID(pk7->PID() ^ 0x10000000);
+            pk7.PID(pk7.PID() ^ 0x10000000);
         }
-        else if (!pk7->shiny() && shiny())
+        else if (!pk7.shiny() && shiny())
         {
-            pk7->PID(u32(((pk7->TID() ^ (pk7->PID() & 0xFFFF)) << 16) | (pk7->PID() & 0xFFFF)));
+            pk7.PID(u32(((pk7.TID() ^ (pk7.PID() & 0xFFFF)) << 16) | (pk7.PID() & 0xFFFF)));
         }
 
         // always has hidden ability unless it doesn't exist
@@ -236,35 +241,34 @@ namespace pksm
             case Species::Misdreavus:
             case Species::Unown:
             case Species::Celebi:
-                pk7->setAbility(0);
+                pk7.setAbility(0);
                 break;
             default:
-                pk7->setAbility(2);
+                pk7.setAbility(2);
         }
 
         if (species() == Species::Mew || species() == Species::Celebi)
         {
-            pk7->fatefulEncounter(true);
+            pk7.fatefulEncounter(true);
         }
         if (nicknamed())
         {
-            pk7->nicknamed(true);
-            pk7->nickname(japanese ? StringUtils::fixJapaneseNameTransporter(nicknameTransporter())
-                                   : nicknameTransporter());
+            pk7.nicknamed(true);
+            pk7.nickname(japanese ? StringUtils::fixJapaneseNameTransporter(nicknameTransporter())
+                                  : nicknameTransporter());
         }
 
-        pk7->otName(japanese ? StringUtils::fixJapaneseNameTransporter(transferOT(save.language()))
-                             : transferOT(save.language()));
-        pk7->otGender(otGender());
+        pk7.otName(japanese ? StringUtils::fixJapaneseNameTransporter(transferOT(save.language()))
+                            : transferOT(save.language()));
+        pk7.otGender(otGender());
 
-        pk7->htMemory(4);
-        pk7->htTextVar(0);
-        pk7->htIntensity(1);
-        pk7->htFeeling(randomNumber(0, 9));
+        pk7.htMemory(4);
+        pk7.htTextVar(0);
+        pk7.htIntensity(1);
+        pk7.htFeeling(randomNumber(0, 9));
 
-        pk7->fixMoves();
-        pk7->refreshChecksum();
-        return pk7;
+        pk7.fixMoves();
+        pk7.refreshChecksum();
     }
 
     std::unique_ptr<PK8> PK2::convertToG8(Sav& save) const
@@ -311,6 +315,12 @@ namespace pksm
             shiftedData, 48 + (japanese ? 6 : 11), japanese ? 6 : 11, lang);
     }
 
+    size_t PK2::nickname(char* out, size_t size) const
+    {
+        return StringUtils::getString2(
+            shiftedData, 48 + (japanese ? 6 : 11), japanese ? 6 : 11, lang, {out, size});
+    }
+
     std::string PK2::nicknameTransporter() const
     {
         return StringUtils::getString2(
@@ -351,6 +361,11 @@ namespace pksm
         return StringUtils::getString2(shiftedData, 48, japanese ? 6 : 11, lang);
     }
 
+    size_t PK2::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString2(shiftedData, 48, japanese ? 6 : 11, lang, {out, size});
+    }
+
     void PK2::otName(const std::string_view& v)
     {
         StringUtils::setString2(shiftedData, v, 48, japanese ? 6 : 11, lang, japanese ? 6 : 11, 0);
@@ -735,13 +750,7 @@ namespace pksm
 
     u8 PK2::level() const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExp(experience(), expType());
     }
 
     void PK2::level(u8 v)
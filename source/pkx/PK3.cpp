@@ -232,6 +232,11 @@ namespace pksm
         return StringUtils::getString3(data, 0x08, 10, japanese());
     }
 
+    size_t PK3::nickname(char* out, size_t size) const
+    {
+        return StringUtils::getString3(data, 0x08, 10, japanese(), {out, size});
+    }
+
     void PK3::nickname(const std::string_view& v)
     {
         StringUtils::setString3(data, v, 0x08, 10, japanese());
@@ -282,6 +287,11 @@ namespace pksm
         return StringUtils::getString3(data, 0x14, 7, japanese());
     }
 
+    size_t PK3::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString3(data, 0x14, 7, japanese(), {out, size});
+    }
+
     void PK3::otName(const std::string_view& v)
     {
         StringUtils::setString3(data, v, 0x14, 7, japanese());
@@ -730,7 +740,14 @@ namespace pksm
         return pk2;
     }
 
-    std::unique_ptr<PK4> PK3::convertToG4(Sav&) const
+    std::unique_ptr<PK4> PK3::convertToG4(Sav& save) const
+    {
+        auto pk4 = PKX::getPKM<Generation::FOUR>(nullptr, PK4::BOX_LENGTH);
+        convertToG4(*pk4, save);
+        return pk4;
+    }
+
+    void PK3::convertToG4(PK4& pk4, Sav&) const
     {
         static constexpr std::array<std::array<u8, 18>, 7> trashBytes = {
             {
@@ -750,135 +767,133 @@ namespace pksm
              }
         };
 
-        auto pk4 = PKX::getPKM<Generation::FOUR>(nullptr, PK4::BOX_LENGTH);
 
-        pk4->species(species());
-        pk4->TID(TID());
-        pk4->SID(SID());
-        pk4->experience(egg() ? expTable(5, expType()) : experience());
-        pk4->gender(gender());
-        pk4->alternativeForm(alternativeForm());
-        pk4->nature(nature());
-        pk4->egg(false);
-        pk4->otFriendship(70);
-        pk4->markValue(markValue());
-        pk4->language(language());
-        pk4->ev(Stat::HP, ev(Stat::HP));
-        pk4->ev(Stat::ATK, ev(Stat::ATK));
-        pk4->ev(Stat::DEF, ev(Stat::DEF));
-        pk4->ev(Stat::SPD, ev(Stat::SPD));
-        pk4->ev(Stat::SPATK, ev(Stat::SPATK));
-        pk4->ev(Stat::SPDEF, ev(Stat::SPDEF));
-        pk4->contest(0, contest(0));
-        pk4->contest(1, contest(1));
-        pk4->contest(2, contest(2));
-        pk4->contest(3, contest(3));
-        pk4->contest(4, contest(4));
-        pk4->contest(5, contest(5));
-        pk4->move(0, move(0));
-        pk4->move(1, move(1));
-        pk4->move(2, move(2));
-        pk4->move(3, move(3));
-        pk4->PPUp(0, PPUp(0));
-        pk4->PPUp(1, PPUp(1));
-        pk4->PPUp(2, PPUp(2));
-        pk4->PPUp(3, PPUp(3));
-        pk4->iv(Stat::HP, iv(Stat::HP));
-        pk4->iv(Stat::ATK, iv(Stat::ATK));
-        pk4->iv(Stat::DEF, iv(Stat::DEF));
-        pk4->iv(Stat::SPD, iv(Stat::SPD));
-        pk4->iv(Stat::SPATK, iv(Stat::SPATK));
-        pk4->iv(Stat::SPDEF, iv(Stat::SPDEF));
+        pk4.species(species());
+        pk4.TID(TID());
+        pk4.SID(SID());
+        pk4.experience(egg() ? expTable(5, expType()) : experience());
+        pk4.gender(gender());
+        pk4.alternativeForm(alternativeForm());
+        pk4.nature(nature());
+        pk4.egg(false);
+        pk4.otFriendship(70);
+        pk4.markValue(markValue());
+        pk4.language(language());
+        pk4.ev(Stat::HP, ev(Stat::HP));
+        pk4.ev(Stat::ATK, ev(Stat::ATK));
+        pk4.ev(Stat::DEF, ev(Stat::DEF));
+        pk4.ev(Stat::SPD, ev(Stat::SPD));
+        pk4.ev(Stat::SPATK, ev(Stat::SPATK));
+        pk4.ev(Stat::SPDEF, ev(Stat::SPDEF));
+        pk4.contest(0, contest(0));
+        pk4.contest(1, contest(1));
+        pk4.contest(2, contest(2));
+        pk4.contest(3, contest(3));
+        pk4.contest(4, contest(4));
+        pk4.contest(5, contest(5));
+        pk4.move(0, move(0));
+        pk4.move(1, move(1));
+        pk4.move(2, move(2));
+        pk4.move(3, move(3));
+        pk4.PPUp(0, PPUp(0));
+        pk4.PPUp(1, PPUp(1));
+        pk4.PPUp(2, PPUp(2));
+        pk4.PPUp(3, PPUp(3));
+        pk4.iv(Stat::HP, iv(Stat::HP));
+        pk4.iv(Stat::ATK, iv(Stat::ATK));
+        pk4.iv(Stat::DEF, iv(Stat::DEF));
+        pk4.iv(Stat::SPD, iv(Stat::SPD));
+        pk4.iv(Stat::SPATK, iv(Stat::SPATK));
+        pk4.iv(Stat::SPDEF, iv(Stat::SPDEF));
         if (ability() == PersonalRSFRLGE::ability(formSpecies(), abilityNumber() >> 1))
         {
-            pk4->setAbility(abilityNumber() >> 1);
+            pk4.setAbility(abilityNumber() >> 1);
         }
         else
         {
-            pk4->ability(ability());
+            pk4.ability(ability());
         }
-        pk4->PID(PID());
-        pk4->version(version());
-        pk4->ball(ball());
-        pk4->pkrsStrain(pkrsStrain());
-        pk4->pkrsDays(pkrsDays());
-        pk4->otGender(otGender());
-        pk4->metDate(Date::today());
-        pk4->metLevel(level());
-        pk4->metLocation(0x37); // Pal Park
-        pk4->fatefulEncounter(fatefulEncounter());
-
-        pk4->ribbon(Ribbon::ChampionG3Hoenn, ribbon(Ribbon::ChampionG3Hoenn));
-        pk4->ribbon(Ribbon::Winning, ribbon(Ribbon::Winning));
-        pk4->ribbon(Ribbon::Victory, ribbon(Ribbon::Victory));
-        pk4->ribbon(Ribbon::Artist, ribbon(Ribbon::Artist));
-        pk4->ribbon(Ribbon::Effort, ribbon(Ribbon::Effort));
-        pk4->ribbon(Ribbon::ChampionBattle, ribbon(Ribbon::ChampionBattle));
-        pk4->ribbon(Ribbon::ChampionRegional, ribbon(Ribbon::ChampionRegional));
-        pk4->ribbon(Ribbon::ChampionNational, ribbon(Ribbon::ChampionNational));
-        pk4->ribbon(Ribbon::Country, ribbon(Ribbon::Country));
-        pk4->ribbon(Ribbon::National, ribbon(Ribbon::National));
-        pk4->ribbon(Ribbon::Earth, ribbon(Ribbon::Earth));
-        pk4->ribbon(Ribbon::World, ribbon(Ribbon::World));
+        pk4.PID(PID());
+        pk4.version(version());
+        pk4.ball(ball());
+        pk4.pkrsStrain(pkrsStrain());
+        pk4.pkrsDays(pkrsDays());
+        pk4.otGender(otGender());
+        pk4.metDate(Date::today());
+        pk4.metLevel(level());
+        pk4.metLocation(0x37); // Pal Park
+        pk4.fatefulEncounter(fatefulEncounter());
+
+        pk4.ribbon(Ribbon::ChampionG3Hoenn, ribbon(Ribbon::ChampionG3Hoenn));
+        pk4.ribbon(Ribbon::Winning, ribbon(Ribbon::Winning));
+        pk4.ribbon(Ribbon::Victory, ribbon(Ribbon::Victory));
+        pk4.ribbon(Ribbon::Artist, ribbon(Ribbon::Artist));
+        pk4.ribbon(Ribbon::Effort, ribbon(Ribbon::Effort));
+        pk4.ribbon(Ribbon::ChampionBattle, ribbon(Ribbon::ChampionBattle));
+        pk4.ribbon(Ribbon::ChampionRegional, ribbon(Ribbon::ChampionRegional));
+        pk4.ribbon(Ribbon::ChampionNational, ribbon(Ribbon::ChampionNational));
+        pk4.ribbon(Ribbon::Country, ribbon(Ribbon::Country));
+        pk4.ribbon(Ribbon::National, ribbon(Ribbon::National));
+        pk4.ribbon(Ribbon::Earth, ribbon(Ribbon::Earth));
+        pk4.ribbon(Ribbon::World, ribbon(Ribbon::World));
 
         // Contest ribbons
-        pk4->ribbon(Ribbon::G3Cool, contestRibbonCount(0) > 0);
-        pk4->ribbon(Ribbon::G3CoolSuper, contestRibbonCount(0) > 1);
-        pk4->ribbon(Ribbon::G3CoolHyper, contestRibbonCount(0) > 2);
-        pk4->ribbon(Ribbon::G3CoolMaster, contestRibbonCount(0) > 3);
-        pk4->ribbon(Ribbon::G3Beauty, contestRibbonCount(1) > 0);
-        pk4->ribbon(Ribbon::G3BeautySuper, contestRibbonCount(1) > 1);
-        pk4->ribbon(Ribbon::G3BeautyHyper, contestRibbonCount(1) > 2);
-        pk4->ribbon(Ribbon::G3BeautyMaster, contestRibbonCount(1) > 3);
-        pk4->ribbon(Ribbon::G3Cute, contestRibbonCount(2) > 0);
-        pk4->ribbon(Ribbon::G3CuteSuper, contestRibbonCount(2) > 1);
-        pk4->ribbon(Ribbon::G3CuteHyper, contestRibbonCount(2) > 2);
-        pk4->ribbon(Ribbon::G3CuteMaster, contestRibbonCount(2) > 3);
-        pk4->ribbon(Ribbon::G3Smart, contestRibbonCount(3) > 0);
-        pk4->ribbon(Ribbon::G3SmartSuper, contestRibbonCount(3) > 1);
-        pk4->ribbon(Ribbon::G3SmartHyper, contestRibbonCount(3) > 2);
-        pk4->ribbon(Ribbon::G3SmartMaster, contestRibbonCount(3) > 3);
-        pk4->ribbon(Ribbon::G3Tough, contestRibbonCount(4) > 0);
-        pk4->ribbon(Ribbon::G3ToughSuper, contestRibbonCount(4) > 1);
-        pk4->ribbon(Ribbon::G3ToughHyper, contestRibbonCount(4) > 2);
-        pk4->ribbon(Ribbon::G3ToughMaster, contestRibbonCount(4) > 3);
+        pk4.ribbon(Ribbon::G3Cool, contestRibbonCount(0) > 0);
+        pk4.ribbon(Ribbon::G3CoolSuper, contestRibbonCount(0) > 1);
+        pk4.ribbon(Ribbon::G3CoolHyper, contestRibbonCount(0) > 2);
+        pk4.ribbon(Ribbon::G3CoolMaster, contestRibbonCount(0) > 3);
+        pk4.ribbon(Ribbon::G3Beauty, contestRibbonCount(1) > 0);
+        pk4.ribbon(Ribbon::G3BeautySuper, contestRibbonCount(1) > 1);
+        pk4.ribbon(Ribbon::G3BeautyHyper, contestRibbonCount(1) > 2);
+        pk4.ribbon(Ribbon::G3BeautyMaster, contestRibbonCount(1) > 3);
+        pk4.ribbon(Ribbon::G3Cute, contestRibbonCount(2) > 0);
+        pk4.ribbon(Ribbon::G3CuteSuper, contestRibbonCount(2) > 1);
+        pk4.ribbon(Ribbon::G3CuteHyper, contestRibbonCount(2) > 2);
+        pk4.ribbon(Ribbon::G3CuteMaster, contestRibbonCount(2) > 3);
+        pk4.ribbon(Ribbon::G3Smart, contestRibbonCount(3) > 0);
+        pk4.ribbon(Ribbon::G3SmartSuper, contestRibbonCount(3) > 1);
+        pk4.ribbon(Ribbon::G3SmartHyper, contestRibbonCount(3) > 2);
+        pk4.ribbon(Ribbon::G3SmartMaster, contestRibbonCount(3) > 3);
+        pk4.ribbon(Ribbon::G3Tough, contestRibbonCount(4) > 0);
+        pk4.ribbon(Ribbon::G3ToughSuper, contestRibbonCount(4) > 1);
+        pk4.ribbon(Ribbon::G3ToughHyper, contestRibbonCount(4) > 2);
+        pk4.ribbon(Ribbon::G3ToughMaster, contestRibbonCount(4) > 3);
 
         // Yay trash bytes
         if ((size_t)(u8(language()) - 1) < trashBytes.size())
         {
             auto& trash = trashBytes[u8(language()) - 1];
-            std::copy(trash.begin(), trash.end(), pk4->rawData().begin() + 0x48 + 4);
+            std::copy(trash.begin(), trash.end(), pk4.rawData().begin() + 0x48 + 4);
         }
 
         std::string name = species().localize(language());
-        pk4->nickname(egg() ? StringUtils::toUpper(name) : nickname());
-        pk4->nicknamed(!egg() && nicknamed());
+        pk4.nickname(egg() ? StringUtils::toUpper(name) : nickname());
+        pk4.nicknamed(!egg() && nicknamed());
 
         // Copy nickname trash into OT name
-        std::ranges::copy(pk4->rawData().subspan(0x48, 0x10), pk4->rawData().begin() + 0x68);
-        pk4->otName(otName());
+        std::ranges::copy(pk4.rawData().subspan(0x48, 0x10), pk4.rawData().begin() + 0x68);
+        pk4.otName(otName());
 
         // I use 0 for invalid items
-        pk4->heldItem(heldItem() == ItemConverter::ITEM_NOT_CONVERTIBLE ? 0 : heldItem());
+        pk4.heldItem(heldItem() == ItemConverter::ITEM_NOT_CONVERTIBLE ? 0 : heldItem());
 
         // Remove HM moves
         for (int i = 0; i < 4; i++)
         {
             static constexpr std::array<Move, 8> hms = {Move::Cut, Move::Fly, Move::Surf,
                 Move::Strength, Move::Flash, Move::RockSmash, Move::Waterfall, Move::Dive};
-            if (std::find(hms.begin(), hms.end(), pk4->move(i)) != hms.end())
+            if (std::find(hms.begin(), hms.end(), pk4.move(i)) != hms.end())
             {
-                pk4->move(i, Move::None);
+                pk4.move(i, Move::None);
             }
             else
             {
-                pk4->move(i, move(i));
+                pk4.move(i, move(i));
             }
         }
-        pk4->fixMoves();
+        pk4.fixMoves();
 
-        pk4->refreshChecksum();
-        return pk4;
+        pk4.refreshChecksum();
     }
 
     std::unique_ptr<PK5> PK3::convertToG5(Sav& save) const
@@ -947,13 +962,7 @@ namespace pksm
 
     u8 PK3::level() const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExp(experience(), expType());
     }
 
     void PK3::level(u8 v)
@@ -221,16 +221,8 @@ namespace pksm
     {
         if (!isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
             refreshChecksum();
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
-                data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, checksum());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, PID());
-            }
+            encrypt(data, isParty());
         }
     }
 
@@ -238,22 +230,73 @@ namespace pksm
     {
         if (isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, checksum());
-            if (isParty())
+            decrypt(data, isParty());
+        }
+    }
+
+    bool PK4::isEncrypted() const
+    {
+        return isEncrypted(data);
+    }
+
+    void PK4::cryptBoxData(u8* data, size_t count, bool party, bool crypted)
+    {
+        const size_t length = party ? PARTY_LENGTH : BOX_LENGTH;
+        for (u8* pkm = data; pkm != data + count * length; pkm += length)
+        {
+            if (isEncrypted(pkm))
             {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, PID());
+                decrypt(pkm, party);
+            }
+            if (!crypted && !isEncrypted(pkm))
+            {
+                LittleEndian::convertFrom<u16>(pkm + 0x06, calcChecksum(pkm));
+                encrypt(pkm, party);
             }
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
         }
     }
 
-    bool PK4::isEncrypted() const
+    void PK4::encrypt(u8* data, bool party)
+    {
+        u32 pid = LittleEndian::convertTo<u32>(data);
+        u8 sv   = (pid >> 13) & 31;
+        pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
+            data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
+        pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
+            data + ENCRYPTION_START, LittleEndian::convertTo<u16>(data + 0x06));
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, pid);
+        }
+    }
+
+    void PK4::decrypt(u8* data, bool party)
+    {
+        u32 pid = LittleEndian::convertTo<u32>(data);
+        u8 sv   = (pid >> 13) & 31;
+        pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
+            data + ENCRYPTION_START, LittleEndian::convertTo<u16>(data + 0x06));
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, pid);
+        }
+        pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+    }
+
+    bool PK4::isEncrypted(const u8* data)
     {
         return LittleEndian::convertTo<u32>(data + 0x64) != 0;
     }
 
+    void PK4::decryptBlocks(const u8* data, u8* out, size_t first, size_t last)
+    {
+        u32 pid = LittleEndian::convertTo<u32>(data);
+        std::copy(data, data + ENCRYPTION_START, out);
+        pksm::crypto::pkm::decryptBlocks<BLOCK_LENGTH>(data + ENCRYPTION_START,
+            out + ENCRYPTION_START, LittleEndian::convertTo<u16>(data + 0x06), (pid >> 13) & 31,
+            first, last);
+    }
+
     PK4::PK4(PrivateConstructor, u8* dt, bool party, bool direct)
         : PKX(dt, party ? PARTY_LENGTH : BOX_LENGTH, direct)
     {
@@ -597,6 +640,11 @@ namespace pksm
         return StringUtils::transString45(StringUtils::getString4(data, 0x48, 11));
     }
 
+    size_t PK4::nickname(char* out, size_t size) const
+    {
+        return StringUtils::getString4(data, 0x48, 11, {out, size}, StringUtils::transString45);
+    }
+
     void PK4::nickname(const std::string_view& v)
     {
         StringUtils::setString4(data, StringUtils::transString45(v), 0x48, 11);
@@ -617,6 +665,11 @@ namespace pksm
         return StringUtils::transString45(StringUtils::getString4(data, 0x68, 8));
     }
 
+    size_t PK4::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString4(data, 0x68, 8, {out, size}, StringUtils::transString45);
+    }
+
     void PK4::otName(const std::string_view& v)
     {
         StringUtils::setString4(data, StringUtils::transString45(v), 0x68, 8);
@@ -851,13 +904,18 @@ namespace pksm
     }
 
     void PK4::refreshChecksum(void)
+    {
+        checksum(calcChecksum(data));
+    }
+
+    u16 PK4::calcChecksum(const u8* data)
     {
         u16 chk = 0;
-        for (u8 i = 8; i < BOX_LENGTH; i += 2)
+        for (size_t i = 8; i < BOX_LENGTH; i += 2)
         {
             chk += LittleEndian::convertTo<u16>(data + i);
         }
-        checksum(chk);
+        return chk;
     }
 
     Type PK4::hpType(void) const
@@ -913,13 +971,7 @@ namespace pksm
 
     u8 PK4::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExp(experience(), expType());
     }
 
     void PK4::level(u8 v)
@@ -1190,42 +1242,49 @@ namespace pksm
         return pk3;
     }
 
-    std::unique_ptr<PK5> PK4::convertToG5(Sav&) const
+    std::unique_ptr<PK5> PK4::convertToG5(Sav& save) const
     {
-        auto pk5 = PKX::getPKM<Generation::FIVE>(data, PK5::BOX_LENGTH);
+        auto pk5 = PKX::getPKM<Generation::FIVE>(nullptr, PK5::BOX_LENGTH);
+        convertToG5(*pk5, save);
+        return pk5;
+    }
+
+    void PK4::convertToG5(PK5& pk5, Sav&) const
+    {
+        std::copy(data, data + PK5::BOX_LENGTH, pk5.rawData().begin());
 
         // Clear HGSS data
-        LittleEndian::convertFrom<u16>(data + 0x86, 0);
+        LittleEndian::convertFrom<u16>(pk5.rawData().data() + 0x86, 0);
 
         // Clear PtHGSS met data
-        LittleEndian::convertFrom<u32>(data + 0x44, 0);
+        LittleEndian::convertFrom<u32>(pk5.rawData().data() + 0x44, 0);
 
-        pk5->otFriendship(70);
-        pk5->metDate(Date::today());
+        pk5.otFriendship(70);
+        pk5.metDate(Date::today());
 
         // Force normal Arceus form
-        if (pk5->species() == Species::Arceus)
+        if (pk5.species() == Species::Arceus)
         {
-            pk5->alternativeForm(0);
+            pk5.alternativeForm(0);
         }
 
-        pk5->heldItem(0);
+        pk5.heldItem(0);
 
-        pk5->nature(nature());
+        pk5.nature(nature());
 
         // Check met location
-        pk5->metLocation(pk5->originGen4() && pk5->fatefulEncounter() &&
-                                 std::find(beasts, beasts + 4, pk5->species()) != beasts + 4
-                             ? (pk5->species() == Species::Celebi ? 30010 : 30012) // Celebi : Beast
-                             : 30001); // Pokétransfer (not Crown)
+        pk5.metLocation(pk5.originGen4() && pk5.fatefulEncounter() &&
+                                std::find(beasts, beasts + 4, pk5.species()) != beasts + 4
+                            ? (pk5.species() == Species::Celebi ? 30010 : 30012) // Celebi : Beast
+                            : 30001); // Pokétransfer (not Crown)
 
-        pk5->ball(ball());
+        pk5.ball(ball());
 
-        pk5->nickname(nickname());
-        pk5->otName(otName());
+        pk5.nickname(nickname());
+        pk5.otName(otName());
 
         // Check level
-        pk5->metLevel(pk5->level());
+        pk5.metLevel(pk5.level());
 
         // Remove HM
         Move moves[4] = {move(0), move(1), move(2), move(3)};
@@ -1236,12 +1295,11 @@ namespace pksm
             {
                 moves[i] = Move::None;
             }
-            pk5->move(i, moves[i]);
+            pk5.move(i, moves[i]);
         }
-        pk5->fixMoves();
+        pk5.fixMoves();
 
-        pk5->refreshChecksum();
-        return pk5;
+        pk5.refreshChecksum();
     }
 
     std::unique_ptr<PK6> PK4::convertToG6(Sav& save) const
@@ -305,16 +305,8 @@ namespace pksm
     {
         if (!isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
             refreshChecksum();
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
-                data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, checksum());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, PID());
-            }
+            encrypt(data, isParty());
         }
     }
 
@@ -322,22 +314,73 @@ namespace pksm
     {
         if (isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, checksum());
-            if (isParty())
+            decrypt(data, isParty());
+        }
+    }
+
+    bool PK5::isEncrypted() const
+    {
+        return isEncrypted(data);
+    }
+
+    void PK5::cryptBoxData(u8* data, size_t count, bool party, bool crypted)
+    {
+        const size_t length = party ? PARTY_LENGTH : BOX_LENGTH;
+        for (u8* pkm = data; pkm != data + count * length; pkm += length)
+        {
+            if (isEncrypted(pkm))
             {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, PID());
+                decrypt(pkm, party);
+            }
+            if (!crypted && !isEncrypted(pkm))
+            {
+                LittleEndian::convertFrom<u16>(pkm + 0x06, calcChecksum(pkm));
+                encrypt(pkm, party);
             }
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
         }
     }
 
-    bool PK5::isEncrypted() const
+    void PK5::encrypt(u8* data, bool party)
+    {
+        u32 pid = LittleEndian::convertTo<u32>(data);
+        u8 sv   = (pid >> 13) & 31;
+        pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
+            data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
+        pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
+            data + ENCRYPTION_START, LittleEndian::convertTo<u16>(data + 0x06));
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, pid);
+        }
+    }
+
+    void PK5::decrypt(u8* data, bool party)
+    {
+        u32 pid = LittleEndian::convertTo<u32>(data);
+        u8 sv   = (pid >> 13) & 31;
+        pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
+            data + ENCRYPTION_START, LittleEndian::convertTo<u16>(data + 0x06));
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, pid);
+        }
+        pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+    }
+
+    bool PK5::isEncrypted(const u8* data)
     {
         return LittleEndian::convertTo<u32>(data + 0x64) != 0;
     }
 
+    void PK5::decryptBlocks(const u8* data, u8* out, size_t first, size_t last)
+    {
+        u32 pid = LittleEndian::convertTo<u32>(data);
+        std::copy(data, data + ENCRYPTION_START, out);
+        pksm::crypto::pkm::decryptBlocks<BLOCK_LENGTH>(data + ENCRYPTION_START,
+            out + ENCRYPTION_START, LittleEndian::convertTo<u16>(data + 0x06), (pid >> 13) & 31,
+            first, last);
+    }
+
     PK5::PK5(PrivateConstructor, u8* dt, bool party, bool direct)
         : PKX(dt, party ? PARTY_LENGTH : BOX_LENGTH, direct)
     {
@@ -702,6 +745,12 @@ namespace pksm
         return StringUtils::transString45(StringUtils::getString(data, 0x48, 11, u'\uFFFF'));
     }
 
+    size_t PK5::nickname(char* out, size_t size) const
+    {
+        return StringUtils::getString(
+            data, 0x48, 11, {out, size}, u'\uFFFF', StringUtils::transString45);
+    }
+
     void PK5::nickname(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString45(v), 0x48, 11, u'\uFFFF', 0);
@@ -722,6 +771,12 @@ namespace pksm
         return StringUtils::transString45(StringUtils::getString(data, 0x68, 8, u'\uFFFF'));
     }
 
+    size_t PK5::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString(
+            data, 0x68, 8, {out, size}, u'\uFFFF', StringUtils::transString45);
+    }
+
     void PK5::otName(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString45(v), 0x68, 8, u'\uFFFF', 0);
@@ -878,13 +933,18 @@ namespace pksm
     }
 
     void PK5::refreshChecksum(void)
+    {
+        checksum(calcChecksum(data));
+    }
+
+    u16 PK5::calcChecksum(const u8* data)
     {
         u16 chk = 0;
-        for (u8 i = 8; i < BOX_LENGTH; i += 2)
+        for (size_t i = 8; i < BOX_LENGTH; i += 2)
         {
             chk += LittleEndian::convertTo<u16>(data + i);
         }
-        checksum(chk);
+        return chk;
     }
 
     Type PK5::hpType(void) const
@@ -940,13 +1000,7 @@ namespace pksm
 
     u8 PK5::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExp(experience(), expType());
     }
 
     void PK5::level(u8 v)
@@ -1149,14 +1203,19 @@ namespace pksm
     std::unique_ptr<PK6> PK5::convertToG6(Sav& save) const
     {
         auto pk6 = PKX::getPKM<Generation::SIX>(nullptr, PK6::BOX_LENGTH);
+        convertToG6(*pk6, save);
+        return pk6;
+    }
 
-        pk6->encryptionConstant(PID());
-        pk6->species(species());
-        pk6->TID(TID());
-        pk6->SID(SID());
-        pk6->experience(experience());
-        pk6->PID(PID());
-        pk6->ability(ability());
+    void PK5::convertToG6(PK6& pk6, Sav& save) const
+    {
+        pk6.encryptionConstant(PID());
+        pk6.species(species());
+        pk6.TID(TID());
+        pk6.SID(SID());
+        pk6.experience(experience());
+        pk6.PID(PID());
+        pk6.ability(ability());
 
         Ability pkmAbilities[3] = {abilities(0), abilities(1), abilities(2)};
         u8 abilVal =
@@ -1167,69 +1226,69 @@ namespace pksm
         }
         if (abilVal < 3)
         {
-            pk6->abilityNumber(1 << abilVal);
+            pk6.abilityNumber(1 << abilVal);
         }
         else // Shouldn't happen
         {
             if (hiddenAbility())
             {
-                pk6->abilityNumber(4);
+                pk6.abilityNumber(4);
             }
             else
             {
-                pk6->abilityNumber(originGen5() ? ((PID() >> 16) & 1) : 1 << (PID() & 1));
+                pk6.abilityNumber(originGen5() ? ((PID() >> 16) & 1) : 1 << (PID() & 1));
             }
         }
 
-        pk6->markValue(markValue());
-        pk6->language(language());
+        pk6.markValue(markValue());
+        pk6.language(language());
 
         for (int i = 0; i < 6; i++)
         {
             // EV Cap
-            pk6->ev(Stat(i), ev(Stat(i)) > 252 ? 252 : ev(Stat(i)));
-            pk6->iv(Stat(i), iv(Stat(i)));
-            pk6->contest(i, contest(i));
+            pk6.ev(Stat(i), ev(Stat(i)) > 252 ? 252 : ev(Stat(i)));
+            pk6.iv(Stat(i), iv(Stat(i)));
+            pk6.contest(i, contest(i));
         }
 
         for (int i = 0; i < 4; i++)
         {
-            pk6->move(i, move(i));
-            pk6->PPUp(i, PPUp(i));
-            pk6->PP(i, PP(i));
+            pk6.move(i, move(i));
+            pk6.PPUp(i, PPUp(i));
+            pk6.PP(i, PP(i));
         }
 
-        pk6->egg(egg());
-        pk6->nicknamed(nicknamed());
+        pk6.egg(egg());
+        pk6.nicknamed(nicknamed());
 
-        pk6->fatefulEncounter(fatefulEncounter());
-        pk6->gender(gender());
-        pk6->alternativeForm(alternativeForm());
-        pk6->nature(nature());
+        pk6.fatefulEncounter(fatefulEncounter());
+        pk6.gender(gender());
+        pk6.alternativeForm(alternativeForm());
+        pk6.nature(nature());
 
-        pk6->nickname(pk6->species().localize(pk6->language()));
+        pk6.nickname(pk6.species().localize(pk6.language()));
         if (nicknamed())
         {
-            pk6->nickname(nickname());
+            pk6.nickname(nickname());
         }
 
-        pk6->version(version());
+        pk6.version(version());
 
-        pk6->otName(otName());
+        pk6.otName(otName());
 
-        pk6->metDate(metDate());
-        pk6->eggDate(eggDate());
+        pk6.metDate(metDate());
+        pk6.eggDate(eggDate());
 
-        pk6->metLocation(metLocation());
-        pk6->eggLocation(eggLocation());
+        pk6.metLocation(metLocation());
+        pk6.eggLocation(eggLocation());
 
-        pk6->pkrsStrain(pkrsStrain());
-        pk6->pkrsDays(pkrsDays());
-        pk6->ball(ball());
+        pk6.pkrsStrain(pkrsStrain());
+        pk6.pkrsDays(pkrsDays());
+        pk6.ball(ball());
 
-        pk6->metLevel(metLevel());
-        pk6->otGender(otGender());
-        pk6->encounterType(encounterType());
+        pk6.metLevel(metLevel());
+        pk6.otGender(otGender());
+        pk6.encounterType(encounterType());
 
         // Ribbon
         u8 contestRibbon = 0;
@@ -1284,80 +1343,79 @@ namespace pksm
             }
         }
 
-        pk6->ribbonContestCount(contestRibbon);
-        pk6->ribbonBattleCount(battleRibbon);
-
-        pk6->ribbon(Ribbon::ChampionG3Hoenn, ribbon(Ribbon::ChampionG3Hoenn));
-        pk6->ribbon(Ribbon::ChampionSinnoh, ribbon(Ribbon::ChampionSinnoh));
-        pk6->ribbon(Ribbon::Effort, ribbon(Ribbon::Effort));
-
-        pk6->ribbon(Ribbon::Alert, ribbon(Ribbon::Alert));
-        pk6->ribbon(Ribbon::Shock, ribbon(Ribbon::Shock));
-        pk6->ribbon(Ribbon::Downcast, ribbon(Ribbon::Downcast));
-        pk6->ribbon(Ribbon::Careless, ribbon(Ribbon::Careless));
-        pk6->ribbon(Ribbon::Relax, ribbon(Ribbon::Relax));
-        pk6->ribbon(Ribbon::Snooze, ribbon(Ribbon::Snooze));
-        pk6->ribbon(Ribbon::Smile, ribbon(Ribbon::Smile));
-        pk6->ribbon(Ribbon::Gorgeous, ribbon(Ribbon::Gorgeous));
-
-        pk6->ribbon(Ribbon::Royal, ribbon(Ribbon::Royal));
-        pk6->ribbon(Ribbon::GorgeousRoyal, ribbon(Ribbon::GorgeousRoyal));
-        pk6->ribbon(Ribbon::Artist, ribbon(Ribbon::Artist));
-        pk6->ribbon(Ribbon::Footprint, ribbon(Ribbon::Footprint));
-        pk6->ribbon(Ribbon::Record, ribbon(Ribbon::Record));
-        pk6->ribbon(Ribbon::Legend, ribbon(Ribbon::Legend));
-        pk6->ribbon(Ribbon::Country, ribbon(Ribbon::Country));
-        pk6->ribbon(Ribbon::National, ribbon(Ribbon::National));
-
-        pk6->ribbon(Ribbon::Earth, ribbon(Ribbon::Earth));
-        pk6->ribbon(Ribbon::World, ribbon(Ribbon::World));
-        pk6->ribbon(Ribbon::Classic, ribbon(Ribbon::Classic));
-        pk6->ribbon(Ribbon::Premier, ribbon(Ribbon::Premier));
-        pk6->ribbon(Ribbon::Event, ribbon(Ribbon::Event));
-        pk6->ribbon(Ribbon::Birthday, ribbon(Ribbon::Birthday));
-        pk6->ribbon(Ribbon::Special, ribbon(Ribbon::Special));
-        pk6->ribbon(Ribbon::Souvenir, ribbon(Ribbon::Souvenir));
-
-        pk6->ribbon(Ribbon::Wishing, ribbon(Ribbon::Wishing));
-        pk6->ribbon(Ribbon::ChampionBattle, ribbon(Ribbon::ChampionBattle));
-        pk6->ribbon(Ribbon::ChampionRegional, ribbon(Ribbon::ChampionRegional));
-        pk6->ribbon(Ribbon::ChampionNational, ribbon(Ribbon::ChampionNational));
-        pk6->ribbon(Ribbon::ChampionWorld, ribbon(Ribbon::ChampionWorld));
-
-        pk6->region(save.subRegion());
-        pk6->country(save.country());
-        pk6->consoleRegion(save.consoleRegion());
-
-        pk6->currentHandler(PKXHandler::NonOT);
-        pk6->htName(save.otName());
-        pk6->htGender(save.gender());
-        pk6->geoRegion(0, save.subRegion());
-        pk6->geoCountry(0, save.country());
-        pk6->htIntensity(1);
-        pk6->htMemory(4);
-        pk6->htFeeling(pksm::randomNumber(0, 9));
-        pk6->otFriendship(pk6->baseFriendship());
-        pk6->htFriendship(pk6->baseFriendship());
+        pk6.ribbonContestCount(contestRibbon);
+        pk6.ribbonBattleCount(battleRibbon);
+
+        pk6.ribbon(Ribbon::ChampionG3Hoenn, ribbon(Ribbon::ChampionG3Hoenn));
+        pk6.ribbon(Ribbon::ChampionSinnoh, ribbon(Ribbon::ChampionSinnoh));
+        pk6.ribbon(Ribbon::Effort, ribbon(Ribbon::Effort));
+
+        pk6.ribbon(Ribbon::Alert, ribbon(Ribbon::Alert));
+        pk6.ribbon(Ribbon::Shock, ribbon(Ribbon::Shock));
+        pk6.ribbon(Ribbon::Downcast, ribbon(Ribbon::Downcast));
+        pk6.ribbon(Ribbon::Careless, ribbon(Ribbon::Careless));
+        pk6.ribbon(Ribbon::Relax, ribbon(Ribbon::Relax));
+        pk6.ribbon(Ribbon::Snooze, ribbon(Ribbon::Snooze));
+        pk6.ribbon(Ribbon::Smile, ribbon(Ribbon::Smile));
+        pk6.ribbon(Ribbon::Gorgeous, ribbon(Ribbon::Gorgeous));
+
+        pk6.ribbon(Ribbon::Royal, ribbon(Ribbon::Royal));
+        pk6.ribbon(Ribbon::GorgeousRoyal, ribbon(Ribbon::GorgeousRoyal));
+        pk6.ribbon(Ribbon::Artist, ribbon(Ribbon::Artist));
+        pk6.ribbon(Ribbon::Footprint, ribbon(Ribbon::Footprint));
+        pk6.ribbon(Ribbon::Record, ribbon(Ribbon::Record));
+        pk6.ribbon(Ribbon::Legend, ribbon(Ribbon::Legend));
+        pk6.ribbon(Ribbon::Country, ribbon(Ribbon::Country));
+        pk6.ribbon(Ribbon::National, ribbon(Ribbon::National));
+
+        pk6.ribbon(Ribbon::Earth, ribbon(Ribbon::Earth));
+        pk6.ribbon(Ribbon::World, ribbon(Ribbon::World));
+        pk6.ribbon(Ribbon::Classic, ribbon(Ribbon::Classic));
+        pk6.ribbon(Ribbon::Premier, ribbon(Ribbon::Premier));
+        pk6.ribbon(Ribbon::Event, ribbon(Ribbon::Event));
+        pk6.ribbon(Ribbon::Birthday, ribbon(Ribbon::Birthday));
+        pk6.ribbon(Ribbon::Special, ribbon(Ribbon::Special));
+        pk6.ribbon(Ribbon::Souvenir, ribbon(Ribbon::Souvenir));
+
+        pk6.ribbon(Ribbon::Wishing, ribbon(Ribbon::Wishing));
+        pk6.ribbon(Ribbon::ChampionBattle, ribbon(Ribbon::ChampionBattle));
+        pk6.ribbon(Ribbon::ChampionRegional, ribbon(Ribbon::ChampionRegional));
+        pk6.ribbon(Ribbon::ChampionNational, ribbon(Ribbon::ChampionNational));
+        pk6.ribbon(Ribbon::ChampionWorld, ribbon(Ribbon::ChampionWorld));
+
+        pk6.region(save.subRegion());
+        pk6.country(save.country());
+        pk6.consoleRegion(save.consoleRegion());
+
+        pk6.currentHandler(PKXHandler::NonOT);
+        pk6.htName(save.otName());
+        pk6.htGender(save.gender());
+        pk6.geoRegion(0, save.subRegion());
+        pk6.geoCountry(0, save.country());
+        pk6.htIntensity(1);
+        pk6.htMemory(4);
+        pk6.htFeeling(pksm::randomNumber(0, 9));
+        pk6.otFriendship(pk6.baseFriendship());
+        pk6.htFriendship(pk6.baseFriendship());
 
         u32 shiny = 0;
         shiny     = (PID() >> 16) ^ (PID() & 0xFFFF) ^ TID() ^ SID();
         if (shiny >= 8 && shiny < 16)
         { // Illegal shiny transfer
-            pk6->PID(pk6->PID() ^ 0x80000000);
+            pk6.PID(pk6.PID() ^ 0x80000000);
         }
 
-        pk6->fixMoves();
+        pk6.fixMoves();
 
-        std::u16string toFix = StringUtils::UTF8toUCS2(pk6->otName());
+        std::u16string toFix = StringUtils::UTF8toUCS2(pk6.otName());
         fixString(toFix);
-        pk6->otName(StringUtils::UCS2toUTF8(toFix));
+        pk6.otName(StringUtils::UCS2toUTF8(toFix));
 
-        toFix = StringUtils::UTF8toUCS2(pk6->nickname());
+        toFix = StringUtils::UTF8toUCS2(pk6.nickname());
         fixString(toFix);
-        pk6->nickname(StringUtils::UCS2toUTF8(toFix));
+        pk6.nickname(StringUtils::UCS2toUTF8(toFix));
 
-        pk6->refreshChecksum();
-        return pk6;
+        pk6.refreshChecksum();
     }
 
     std::unique_ptr<PK3> PK5::convertToG3(Sav& save) const
@@ -188,17 +188,8 @@ namespace pksm
     {
         if (!isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
             refreshChecksum();
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
-                data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
-            }
+            encrypt(data, isParty());
         }
     }
 
@@ -206,24 +197,71 @@ namespace pksm
     {
         if (isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
+            decrypt(data, isParty());
+        }
+    }
+
+    bool PK6::isEncrypted() const
+    {
+        return isEncrypted(data);
+    }
+
+    void PK6::cryptBoxData(u8* data, size_t count, bool party, bool crypted)
+    {
+        const size_t length = party ? PARTY_LENGTH : BOX_LENGTH;
+        for (u8* pkm = data; pkm != data + count * length; pkm += length)
+        {
+            if (isEncrypted(pkm))
             {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
+                decrypt(pkm, party);
+            }
+            if (!crypted && !isEncrypted(pkm))
+            {
+                LittleEndian::convertFrom<u16>(pkm + 0x06, calcChecksum(pkm));
+                encrypt(pkm, party);
             }
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
         }
     }
 
-    bool PK6::isEncrypted() const
+    void PK6::encrypt(u8* data, bool party)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(data);
+        u8 sv  = (ec >> 13) & 31;
+        pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
+            data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
+        pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(data + ENCRYPTION_START, ec);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, ec);
+        }
+    }
+
+    void PK6::decrypt(u8* data, bool party)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(data);
+        u8 sv  = (ec >> 13) & 31;
+        pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(data + ENCRYPTION_START, ec);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, ec);
+        }
+        pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+    }
+
+    bool PK6::isEncrypted(const u8* data)
     {
         return LittleEndian::convertTo<u16>(data + 0xC8) != 0 &&
                LittleEndian::convertTo<u16>(data + 0x58) != 0;
     }
 
+    void PK6::decryptBlocks(const u8* data, u8* out, size_t first, size_t last)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(data);
+        std::copy(data, data + ENCRYPTION_START, out);
+        pksm::crypto::pkm::decryptBlocks<BLOCK_LENGTH>(
+            data + ENCRYPTION_START, out + ENCRYPTION_START, ec, (ec >> 13) & 31, first, last);
+    }
+
     PK6::PK6(PrivateConstructor, u8* dt, bool party, bool direct)
         : PKX(dt, party ? PARTY_LENGTH : BOX_LENGTH, direct)
     {
@@ -554,6 +592,12 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0x40, 13));
     }
 
+    size_t PK6::nickname(char* out, size_t size) const
+    {
+        return StringUtils::getString(
+            data, 0x40, 13, {out, size}, u'\0', StringUtils::transString67);
+    }
+
     void PK6::nickname(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0x40, 13);
@@ -791,6 +835,12 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0xB0, 13));
     }
 
+    size_t PK6::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString(
+            data, 0xB0, 13, {out, size}, u'\0', StringUtils::transString67);
+    }
+
     void PK6::otName(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0xB0, 13);
@@ -1027,13 +1077,18 @@ namespace pksm
     }
 
     void PK6::refreshChecksum(void)
+    {
+        checksum(calcChecksum(data));
+    }
+
+    u16 PK6::calcChecksum(const u8* data)
     {
         u16 chk = 0;
-        for (u8 i = 8; i < BOX_LENGTH; i += 2)
+        for (size_t i = 8; i < BOX_LENGTH; i += 2)
         {
             chk += LittleEndian::convertTo<u16>(data + i);
         }
-        checksum(chk);
+        return chk;
     }
 
     Type PK6::hpType(void) const
@@ -1089,13 +1144,7 @@ namespace pksm
 
     u8 PK6::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExp(experience(), expType());
     }
 
     void PK6::level(u8 v)
@@ -1404,26 +1453,33 @@ namespace pksm
 
     std::unique_ptr<PK7> PK6::convertToG7(Sav& save) const
     {
-        auto pk7 = PKX::getPKM<Generation::SEVEN>(data, PK7::BOX_LENGTH);
+        auto pk7 = PKX::getPKM<Generation::SEVEN>(nullptr, PK7::BOX_LENGTH);
+        convertToG7(*pk7, save);
+        return pk7;
+    }
+
+    void PK6::convertToG7(PK7& pk7, Sav& save) const
+    {
+        std::copy(data, data + PK7::BOX_LENGTH, pk7.rawData().begin());
 
         // markvalue field moved, clear old gen 6 data
-        pk7->rawData()[0x2A] = 0;
+        pk7.rawData()[0x2A] = 0;
 
         // Bank Data clearing
         for (int i = 0x94; i < 0x9E; i++)
         {
-            pk7->rawData()[i] = 0; // Geolocations
+            pk7.rawData()[i] = 0; // Geolocations
         }
         for (int i = 0xAA; i < 0xB0; i++)
         {
-            pk7->rawData()[i] = 0; // Amie fullness/enjoyment
+            pk7.rawData()[i] = 0; // Amie fullness/enjoyment
         }
         for (int i = 0xE4; i < 0xE8; i++)
         {
-            pk7->rawData()[i] = 0; // unused
+            pk7.rawData()[i] = 0; // unused
         }
-        pk7->rawData()[0x72] &= 0xFC; // low 2 bits of super training
-        pk7->rawData()[0xDE] = 0;     // gen 4 encounter type
+        pk7.rawData()[0x72] &= 0xFC; // low 2 bits of super training
+        pk7.rawData()[0xDE] = 0;     // gen 4 encounter type
 
         // marks get expanded from one bit to two.
         u8 oldMarks  = markValue();
@@ -1432,7 +1488,7 @@ namespace pksm
         {
             newMarks |= ((oldMarks >> i) & 1) << (i << 1);
         }
-        pk7->markValue(newMarks);
+        pk7.markValue(newMarks);
 
         switch (abilityNumber())
         {
@@ -1442,21 +1498,20 @@ namespace pksm
                 u8 index = abilityNumber() >> 1;
                 if (abilities(index) == ability())
                 {
-                    pk7->ability(pk7->abilities(index));
+                    pk7.ability(pk7.abilities(index));
                 }
         }
 
-        pk7->htMemory(4);
-        pk7->htTextVar(0);
-        pk7->htIntensity(1);
-        pk7->htFeeling(pksm::randomNumber(0, 9));
-        pk7->geoCountry(0, save.country());
-        pk7->geoRegion(0, save.subRegion());
+        pk7.htMemory(4);
+        pk7.htTextVar(0);
+        pk7.htIntensity(1);
+        pk7.htFeeling(pksm::randomNumber(0, 9));
+        pk7.geoCountry(0, save.country());
+        pk7.geoRegion(0, save.subRegion());
 
-        pk7->currentHandler(PKXHandler::NonOT);
+        pk7.currentHandler(PKXHandler::NonOT);
 
-        pk7->refreshChecksum();
-        return pk7;
+        pk7.refreshChecksum();
     }
 
     std::unique_ptr<PK8> PK6::convertToG8(Sav& save) const
@@ -160,17 +160,8 @@ namespace pksm
     {
         if (!isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
             refreshChecksum();
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
-                data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
-            }
+            encrypt(data, isParty());
         }
     }
 
@@ -178,24 +169,71 @@ namespace pksm
     {
         if (isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
+            decrypt(data, isParty());
+        }
+    }
+
+    bool PK7::isEncrypted() const
+    {
+        return isEncrypted(data);
+    }
+
+    void PK7::cryptBoxData(u8* data, size_t count, bool party, bool crypted)
+    {
+        const size_t length = party ? PARTY_LENGTH : BOX_LENGTH;
+        for (u8* pkm = data; pkm != data + count * length; pkm += length)
+        {
+            if (isEncrypted(pkm))
             {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
+                decrypt(pkm, party);
+            }
+            if (!crypted && !isEncrypted(pkm))
+            {
+                LittleEndian::convertFrom<u16>(pkm + 0x06, calcChecksum(pkm));
+                encrypt(pkm, party);
             }
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
         }
     }
 
-    bool PK7::isEncrypted() const
+    void PK7::encrypt(u8* data, bool party)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(data);
+        u8 sv  = (ec >> 13) & 31;
+        pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
+            data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
+        pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(data + ENCRYPTION_START, ec);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, ec);
+        }
+    }
+
+    void PK7::decrypt(u8* data, bool party)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(data);
+        u8 sv  = (ec >> 13) & 31;
+        pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(data + ENCRYPTION_START, ec);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, ec);
+        }
+        pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+    }
+
+    bool PK7::isEncrypted(const u8* data)
     {
         return LittleEndian::convertTo<u16>(data + 0xC8) != 0 &&
                LittleEndian::convertTo<u16>(data + 0x58) != 0;
     }
 
+    void PK7::decryptBlocks(const u8* data, u8* out, size_t first, size_t last)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(data);
+        std::copy(data, data + ENCRYPTION_START, out);
+        pksm::crypto::pkm::decryptBlocks<BLOCK_LENGTH>(
+            data + ENCRYPTION_START, out + ENCRYPTION_START, ec, (ec >> 13) & 31, first, last);
+    }
+
     PK7::PK7(PrivateConstructor, u8* dt, bool party, bool direct)
         : PKX(dt, party ? PARTY_LENGTH : BOX_LENGTH, direct)
     {
@@ -505,6 +543,12 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0x40, 13));
     }
 
+    size_t PK7::nickname(char* out, size_t size) const
+    {
+        return StringUtils::getString(
+            data, 0x40, 13, {out, size}, u'\0', StringUtils::transString67);
+    }
+
     void PK7::nickname(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0x40, 13);
@@ -722,6 +766,12 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0xB0, 13));
     }
 
+    size_t PK7::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString(
+            data, 0xB0, 13, {out, size}, u'\0', StringUtils::transString67);
+    }
+
     void PK7::otName(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0xB0, 13);
@@ -960,13 +1010,18 @@ namespace pksm
     }
 
     void PK7::refreshChecksum(void)
+    {
+        checksum(calcChecksum(data));
+    }
+
+    u16 PK7::calcChecksum(const u8* data)
     {
         u16 chk = 0;
-        for (u8 i = 8; i < BOX_LENGTH; i += 2)
+        for (size_t i = 8; i < BOX_LENGTH; i += 2)
         {
             chk += LittleEndian::convertTo<u16>(data + i);
         }
-        checksum(chk);
+        return chk;
     }
 
     Type PK7::hpType(void) const
@@ -1022,13 +1077,7 @@ namespace pksm
 
     u8 PK7::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExp(experience(), expType());
     }
 
     void PK7::level(u8 v)
@@ -1255,128 +1304,131 @@ namespace pksm
     std::unique_ptr<PK8> PK7::convertToG8(Sav& save) const
     {
         auto pk8 = PKX::getPKM<Generation::EIGHT>(nullptr, PK8::BOX_LENGTH);
+        convertToG8(*pk8, save);
+        return pk8;
+    }
 
+    void PK7::convertToG8(PK8& pk8, Sav& save) const
+    {
         // Note: Locale stuff does not transfer
-        pk8->encryptionConstant(encryptionConstant());
-        pk8->species(species());
-        pk8->TID(TID());
-        pk8->SID(SID());
-        pk8->experience(experience());
-        pk8->PID(PID());
+        pk8.encryptionConstant(encryptionConstant());
+        pk8.species(species());
+        pk8.TID(TID());
+        pk8.SID(SID());
+        pk8.experience(experience());
+        pk8.PID(PID());
         if (ability() == PersonalSMUSUM::ability(formSpecies(), abilityNumber() >> 1))
         {
-            pk8->setAbility(abilityNumber() >> 1);
+            pk8.setAbility(abilityNumber() >> 1);
         }
         else
         {
-            pk8->ability(ability());
-            pk8->abilityNumber(abilityNumber());
+            pk8.ability(ability());
+            pk8.abilityNumber(abilityNumber());
         }
-        pk8->language(language());
+        pk8.language(language());
         for (Stat stat : {Stat::HP, Stat::ATK, Stat::DEF, Stat::SPATK, Stat::SPDEF, Stat::SPD})
         {
-            pk8->ev(stat, ev(stat));
-            pk8->iv(stat, iv(stat));
-            pk8->hyperTrain(stat, hyperTrain(stat));
+            pk8.ev(stat, ev(stat));
+            pk8.iv(stat, iv(stat));
+            pk8.hyperTrain(stat, hyperTrain(stat));
         }
         for (size_t i = 0; i < 4; i++)
         {
-            pk8->move(i, move(i));
-            pk8->PPUp(i, PPUp(i));
-            pk8->PP(i, PP(i));
-            pk8->relearnMove(i, relearnMove(i));
+            pk8.move(i, move(i));
+            pk8.PPUp(i, PPUp(i));
+            pk8.PP(i, PP(i));
+            pk8.relearnMove(i, relearnMove(i));
         }
-        pk8->egg(egg());
-        pk8->nicknamed(nicknamed());
-        pk8->nickname(nickname());
-        pk8->fatefulEncounter(fatefulEncounter());
-        pk8->gender(gender());
-        pk8->otGender(otGender());
-        pk8->alternativeForm(alternativeForm());
-        pk8->nature(nature());
-        pk8->version(version());
-        pk8->otName(otName());
-        pk8->metDate(metDate());
-        pk8->eggDate(eggDate());
-        pk8->metLocation(metLocation());
-        pk8->eggLocation(eggLocation());
-        pk8->ball(ball());
-        pk8->metLevel(metLevel());
+        pk8.egg(egg());
+        pk8.nicknamed(nicknamed());
+        pk8.nickname(nickname());
+        pk8.fatefulEncounter(fatefulEncounter());
+        pk8.gender(gender());
+        pk8.otGender(otGender());
+        pk8.alternativeForm(alternativeForm());
+        pk8.nature(nature());
+        pk8.version(version());
+        pk8.otName(otName());
+        pk8.metDate(metDate());
+        pk8.eggDate(eggDate());
+        pk8.metLocation(metLocation());
+        pk8.eggLocation(eggLocation());
+        pk8.ball(ball());
+        pk8.metLevel(metLevel());
 
         // TODO from PKHeX: set proper memories
-        pk8->otMemory(otMemory());
-        pk8->otTextVar(otTextVar());
-        pk8->otFeeling(otFeeling());
-        pk8->otIntensity(otIntensity());
+        pk8.otMemory(otMemory());
+        pk8.otTextVar(otTextVar());
+        pk8.otFeeling(otFeeling());
+        pk8.otIntensity(otIntensity());
 
-        pk8->pkrsStrain(pkrsStrain());
-        pk8->pkrsDays(pkrsDays());
+        pk8.pkrsStrain(pkrsStrain());
+        pk8.pkrsDays(pkrsDays());
 
         for (size_t i = 0; i < 6; i++)
         {
-            pk8->contest(i, contest(i));
+            pk8.contest(i, contest(i));
         }
 
-        pk8->ribbon(Ribbon::ChampionG3Hoenn, ribbon(Ribbon::ChampionG3Hoenn));
-        pk8->ribbon(Ribbon::ChampionSinnoh, ribbon(Ribbon::ChampionSinnoh));
-        pk8->ribbon(Ribbon::Effort, ribbon(Ribbon::Effort));
-        pk8->ribbon(Ribbon::Alert, ribbon(Ribbon::Alert));
-        pk8->ribbon(Ribbon::Shock, ribbon(Ribbon::Shock));
-        pk8->ribbon(Ribbon::Downcast, ribbon(Ribbon::Downcast));
-        pk8->ribbon(Ribbon::Careless, ribbon(Ribbon::Careless));
-        pk8->ribbon(Ribbon::Relax, ribbon(Ribbon::Relax));
-        pk8->ribbon(Ribbon::Snooze, ribbon(Ribbon::Snooze));
-        pk8->ribbon(Ribbon::Smile, ribbon(Ribbon::Smile));
-        pk8->ribbon(Ribbon::Gorgeous, ribbon(Ribbon::Gorgeous));
-        pk8->ribbon(Ribbon::Royal, ribbon(Ribbon::Royal));
-        pk8->ribbon(Ribbon::GorgeousRoyal, ribbon(Ribbon::GorgeousRoyal));
-        pk8->ribbon(Ribbon::Artist, ribbon(Ribbon::Artist));
-        pk8->ribbon(Ribbon::Footprint, ribbon(Ribbon::Footprint));
-        pk8->ribbon(Ribbon::Record, ribbon(Ribbon::Record));
-        pk8->ribbon(Ribbon::Legend, ribbon(Ribbon::Legend));
-        pk8->ribbon(Ribbon::Country, ribbon(Ribbon::Country));
-        pk8->ribbon(Ribbon::National, ribbon(Ribbon::National));
-        pk8->ribbon(Ribbon::Earth, ribbon(Ribbon::Earth));
-        pk8->ribbon(Ribbon::World, ribbon(Ribbon::World));
-        pk8->ribbon(Ribbon::Classic, ribbon(Ribbon::Classic));
-        pk8->ribbon(Ribbon::Premier, ribbon(Ribbon::Premier));
-        pk8->ribbon(Ribbon::Event, ribbon(Ribbon::Event));
-        pk8->ribbon(Ribbon::Birthday, ribbon(Ribbon::Birthday));
-        pk8->ribbon(Ribbon::Special, ribbon(Ribbon::Special));
-        pk8->ribbon(Ribbon::Souvenir, ribbon(Ribbon::Souvenir));
-        pk8->ribbon(Ribbon::Wishing, ribbon(Ribbon::Wishing));
-        pk8->ribbon(Ribbon::ChampionBattle, ribbon(Ribbon::ChampionBattle));
-        pk8->ribbon(Ribbon::ChampionRegional, ribbon(Ribbon::ChampionRegional));
-        pk8->ribbon(Ribbon::ChampionNational, ribbon(Ribbon::ChampionNational));
-        pk8->ribbon(Ribbon::ChampionWorld, ribbon(Ribbon::ChampionWorld));
-        pk8->ribbon(Ribbon::ChampionKalos, ribbon(Ribbon::ChampionKalos));
-        pk8->ribbon(Ribbon::ChampionG6Hoenn, ribbon(Ribbon::ChampionG6Hoenn));
-        pk8->ribbon(Ribbon::BestFriends, ribbon(Ribbon::BestFriends));
-        pk8->ribbon(Ribbon::Training, ribbon(Ribbon::Training));
-        pk8->ribbon(Ribbon::BattlerSkillful, ribbon(Ribbon::BattlerSkillful));
-        pk8->ribbon(Ribbon::BattlerExpert, ribbon(Ribbon::BattlerExpert));
-        pk8->ribbon(Ribbon::ContestStar, ribbon(Ribbon::ContestStar));
-        pk8->ribbon(Ribbon::MasterCoolness, ribbon(Ribbon::MasterCoolness));
-        pk8->ribbon(Ribbon::MasterBeauty, ribbon(Ribbon::MasterBeauty));
-        pk8->ribbon(Ribbon::MasterCuteness, ribbon(Ribbon::MasterCuteness));
-        pk8->ribbon(Ribbon::MasterCleverness, ribbon(Ribbon::MasterCleverness));
-        pk8->ribbon(Ribbon::MasterToughness, ribbon(Ribbon::MasterToughness));
-        pk8->ribbon(Ribbon::ChampionAlola, ribbon(Ribbon::ChampionAlola));
-        pk8->ribbon(Ribbon::BattleRoyale, ribbon(Ribbon::BattleRoyale));
-        pk8->ribbon(Ribbon::BattleTreeGreat, ribbon(Ribbon::BattleTreeGreat));
-        pk8->ribbon(Ribbon::BattleTreeMaster, ribbon(Ribbon::BattleTreeMaster));
-
-        pk8->ribbonContestCount(ribbonContestCount());
-        pk8->ribbonBattleCount(ribbonBattleCount());
-
-        pk8->otFriendship(otFriendship());
-        pk8->origNature(nature());
+        pk8.ribbon(Ribbon::ChampionG3Hoenn, ribbon(Ribbon::ChampionG3Hoenn));
+        pk8.ribbon(Ribbon::ChampionSinnoh, ribbon(Ribbon::ChampionSinnoh));
+        pk8.ribbon(Ribbon::Effort, ribbon(Ribbon::Effort));
+        pk8.ribbon(Ribbon::Alert, ribbon(Ribbon::Alert));
+        pk8.ribbon(Ribbon::Shock, ribbon(Ribbon::Shock));
+        pk8.ribbon(Ribbon::Downcast, ribbon(Ribbon::Downcast));
+        pk8.ribbon(Ribbon::Careless, ribbon(Ribbon::Careless));
+        pk8.ribbon(Ribbon::Relax, ribbon(Ribbon::Relax));
+        pk8.ribbon(Ribbon::Snooze, ribbon(Ribbon::Snooze));
+        pk8.ribbon(Ribbon::Smile, ribbon(Ribbon::Smile));
+        pk8.ribbon(Ribbon::Gorgeous, ribbon(Ribbon::Gorgeous));
+        pk8.ribbon(Ribbon::Royal, ribbon(Ribbon::Royal));
+        pk8.ribbon(Ribbon::GorgeousRoyal, ribbon(Ribbon::GorgeousRoyal));
+        pk8.ribbon(Ribbon::Artist, ribbon(Ribbon::Artist));
+        pk8.ribbon(Ribbon::Footprint, ribbon(Ribbon::Footprint));
+        pk8.ribbon(Ribbon::Record, ribbon(Ribbon::Record));
+        pk8.ribbon(Ribbon::Legend, ribbon(Ribbon::Legend));
+        pk8.ribbon(Ribbon::Country, ribbon(Ribbon::Country));
+        pk8.ribbon(Ribbon::National, ribbon(Ribbon::National));
+        pk8.ribbon(Ribbon::Earth, ribbon(Ribbon::Earth));
+        pk8.ribbon(Ribbon::World, ribbon(Ribbon::World));
+        pk8.ribbon(Ribbon::Classic, ribbon(Ribbon::Classic));
+        pk8.ribbon(Ribbon::Premier, ribbon(Ribbon::Premier));
+        pk8.ribbon(Ribbon::Event, ribbon(Ribbon::Event));
+        pk8.ribbon(Ribbon::Birthday, ribbon(Ribbon::Birthday));
+        pk8.ribbon(Ribbon::Special, ribbon(Ribbon::Special));
+        pk8.ribbon(Ribbon::Souvenir, ribbon(Ribbon::Souvenir));
+        pk8.ribbon(Ribbon::Wishing, ribbon(Ribbon::Wishing));
+        pk8.ribbon(Ribbon::ChampionBattle, ribbon(Ribbon::ChampionBattle));
+        pk8.ribbon(Ribbon::ChampionRegional, ribbon(Ribbon::ChampionRegional));
+        pk8.ribbon(Ribbon::ChampionNational, ribbon(Ribbon::ChampionNational));
+        pk8.ribbon(Ribbon::ChampionWorld, ribbon(Ribbon::ChampionWorld));
+        pk8.ribbon(Ribbon::ChampionKalos, ribbon(Ribbon::ChampionKalos));
+        pk8.ribbon(Ribbon::ChampionG6Hoenn, ribbon(Ribbon::ChampionG6Hoenn));
+        pk8.ribbon(Ribbon::BestFriends, ribbon(Ribbon::BestFriends));
+        pk8.ribbon(Ribbon::Training, ribbon(Ribbon::Training));
+        pk8.ribbon(Ribbon::BattlerSkillful, ribbon(Ribbon::BattlerSkillful));
+        pk8.ribbon(Ribbon::BattlerExpert, ribbon(Ribbon::BattlerExpert));
+        pk8.ribbon(Ribbon::ContestStar, ribbon(Ribbon::ContestStar));
+        pk8.ribbon(Ribbon::MasterCoolness, ribbon(Ribbon::MasterCoolness));
+        pk8.ribbon(Ribbon::MasterBeauty, ribbon(Ribbon::MasterBeauty));
+        pk8.ribbon(Ribbon::MasterCuteness, ribbon(Ribbon::MasterCuteness));
+        pk8.ribbon(Ribbon::MasterCleverness, ribbon(Ribbon::MasterCleverness));
+        pk8.ribbon(Ribbon::MasterToughness, ribbon(Ribbon::MasterToughness));
+        pk8.ribbon(Ribbon::ChampionAlola, ribbon(Ribbon::ChampionAlola));
+        pk8.ribbon(Ribbon::BattleRoyale, ribbon(Ribbon::BattleRoyale));
+        pk8.ribbon(Ribbon::BattleTreeGreat, ribbon(Ribbon::BattleTreeGreat));
+        pk8.ribbon(Ribbon::BattleTreeMaster, ribbon(Ribbon::BattleTreeMaster));
+
+        pk8.ribbonContestCount(ribbonContestCount());
+        pk8.ribbonBattleCount(ribbonBattleCount());
+
+        pk8.otFriendship(otFriendship());
+        pk8.origNature(nature());
 
         // TODO: remove totem forms
 
-        pk8->refreshChecksum();
-
-        return pk8;
+        pk8.refreshChecksum();
     }
 
     int PK7::partyCurrHP(void) const
@@ -247,17 +247,8 @@ namespace pksm
     {
         if (!isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
             refreshChecksum();
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
-                data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
-            {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
-            }
+            encrypt(data, isParty());
         }
     }
 
@@ -265,24 +256,71 @@ namespace pksm
     {
         if (isEncrypted())
         {
-            u8 sv = (encryptionConstant() >> 13) & 31;
-            pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(
-                data + ENCRYPTION_START, encryptionConstant());
-            if (isParty())
+            decrypt(data, isParty());
+        }
+    }
+
+    bool PK8::isEncrypted() const
+    {
+        return isEncrypted(data);
+    }
+
+    void PK8::cryptBoxData(u8* data, size_t count, bool party, bool crypted)
+    {
+        const size_t length = party ? PARTY_LENGTH : BOX_LENGTH;
+        for (u8* pkm = data; pkm != data + count * length; pkm += length)
+        {
+            if (isEncrypted(pkm))
+            {
+                decrypt(pkm, party);
+            }
+            if (!crypted && !isEncrypted(pkm))
             {
-                pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(
-                    data + BOX_LENGTH, encryptionConstant());
+                LittleEndian::convertFrom<u16>(pkm + 0x06, calcChecksum(pkm));
+                encrypt(pkm, party);
             }
-            pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
         }
     }
 
-    bool PK8::isEncrypted() const
+    void PK8::encrypt(u8* data, bool party)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(data);
+        u8 sv  = (ec >> 13) & 31;
+        pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(
+            data + ENCRYPTION_START, pksm::crypto::pkm::InvertedBlockPositions[sv]);
+        pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(data + ENCRYPTION_START, ec);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, ec);
+        }
+    }
+
+    void PK8::decrypt(u8* data, bool party)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(data);
+        u8 sv  = (ec >> 13) & 31;
+        pksm::crypto::pkm::crypt<BOX_LENGTH - ENCRYPTION_START>(data + ENCRYPTION_START, ec);
+        if (party)
+        {
+            pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, ec);
+        }
+        pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+    }
+
+    bool PK8::isEncrypted(const u8* data)
     {
         return LittleEndian::convertTo<u16>(data + 0x70) != 0 &&
                LittleEndian::convertTo<u16>(data + 0xC0) != 0;
     }
 
+    void PK8::decryptBlocks(const u8* data, u8* out, size_t first, size_t last)
+    {
+        u32 ec = LittleEndian::convertTo<u32>(data);
+        std::copy(data, data + ENCRYPTION_START, out);
+        pksm::crypto::pkm::decryptBlocks<BLOCK_LENGTH>(
+            data + ENCRYPTION_START, out + ENCRYPTION_START, ec, (ec >> 13) & 31, first, last);
+    }
+
     PK8::PK8(PrivateConstructor, u8* dt, bool party, bool direct)
         : PKX(dt, party ? PARTY_LENGTH : BOX_LENGTH, direct)
     {
@@ -663,6 +701,12 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0x58, 13));
     }
 
+    size_t PK8::nickname(char* out, size_t size) const
+    {
+        return StringUtils::getString(
+            data, 0x58, 13, {out, size}, u'\0', StringUtils::transString67);
+    }
+
     void PK8::nickname(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0x58, 13);
@@ -940,6 +984,12 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0xF8, 13));
     }
 
+    size_t PK8::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString(
+            data, 0xF8, 13, {out, size}, u'\0', StringUtils::transString67);
+    }
+
     void PK8::otName(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0xF8, 13);
@@ -1190,13 +1240,18 @@ namespace pksm
     }
 
     void PK8::refreshChecksum(void)
+    {
+        checksum(calcChecksum(data));
+    }
+
+    u16 PK8::calcChecksum(const u8* data)
     {
         u16 chk = 0;
         for (size_t i = 8; i < BOX_LENGTH; i += 2)
         {
             chk += LittleEndian::convertTo<u16>(data + i);
         }
-        checksum(chk);
+        return chk;
     }
 
     Type PK8::hpType(void) const
@@ -1252,13 +1307,7 @@ namespace pksm
 
     u8 PK8::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-        {
-            ;
-        }
-        return i;
+        return levelFromExp(experience(), expType());
     }
 
     void PK8::level(u8 v)
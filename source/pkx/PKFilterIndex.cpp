@@ -0,0 +1,272 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "pkx/PKFilterIndex.hpp"
+#include "pkx/PKX.hpp"
+#include "sav/Sav.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace pksm
+{
+    CompiledPKFilter::CompiledPKFilter(const PKFilter& filter)
+    {
+        auto add = [this](u8 column, bool enabled, bool inverse, u16 operand)
+        {
+            if (enabled)
+            {
+                checks.push_back({column, Op::NotEqual, inverse, operand});
+            }
+        };
+
+        // Same order as PKX::operator==, which puts the most selective ones first
+        add(PKFilterIndex::GENERATION, filter.generationEnabled(), filter.generationInversed(),
+            u16(filter.generation()));
+        add(PKFilterIndex::SPECIES, filter.speciesEnabled(), filter.speciesInversed(),
+            u16(filter.species()));
+        add(PKFilterIndex::HELD_ITEM, filter.heldItemEnabled(), filter.heldItemInversed(),
+            filter.heldItem());
+        add(PKFilterIndex::LEVEL, filter.levelEnabled(), filter.levelInversed(), filter.level());
+        add(PKFilterIndex::ABILITY, filter.abilityEnabled(), filter.abilityInversed(),
+            u16(filter.ability()));
+        add(PKFilterIndex::TSV, filter.TSVEnabled(), filter.TSVInversed(), filter.TSV());
+        add(PKFilterIndex::NATURE, filter.natureEnabled(), filter.natureInversed(),
+            u16(filter.nature()));
+        add(PKFilterIndex::GENDER, filter.genderEnabled(), filter.genderInversed(),
+            u16(filter.gender()));
+        add(PKFilterIndex::BALL, filter.ballEnabled(), filter.ballInversed(), u16(filter.ball()));
+        add(PKFilterIndex::LANGUAGE, filter.languageEnabled(), filter.languageInversed(),
+            u16(filter.language()));
+        add(PKFilterIndex::EGG, filter.eggEnabled(), filter.eggInversed(), filter.egg());
+        for (u8 i = 0; i < 4; i++)
+        {
+            add(PKFilterIndex::MOVE + i, filter.moveEnabled(i), filter.moveInversed(i),
+                u16(filter.move(i)));
+            if (filter.relearnMoveEnabled(i))
+            {
+                add(PKFilterIndex::HAS_RELEARN_MOVES, true, false, true);
+                add(PKFilterIndex::RELEARN_MOVE + i, true, filter.relearnMoveInversed(i),
+                    u16(filter.relearnMove(i)));
+            }
+        }
+        for (u8 i = 0; i < 6; i++)
+        {
+            if (filter.ivEnabled(Stat(i)))
+            {
+                checks.push_back({u8(PKFilterIndex::IV + i), Op::Less, filter.ivInversed(Stat(i)),
+                    filter.iv(Stat(i))});
+            }
+        }
+        add(PKFilterIndex::SHINY, filter.shinyEnabled(), filter.shinyInversed(), filter.shiny());
+        add(PKFilterIndex::FORM, filter.alternativeFormEnabled(),
+            filter.alternativeFormInversed(), filter.alternativeForm());
+    }
+
+    PKFilterIndex::PKFilterIndex(const Sav& save)
+        : snapshot(save), occupied((snapshot.size() + 63) / 64)
+    {
+        for (int slot = 0; slot < snapshot.size(); slot++)
+        {
+            indexSlot(slot, true);
+        }
+    }
+
+    void PKFilterIndex::indexSlot(int slot, bool set)
+    {
+        if (snapshot.species[slot] == u16(Species::None))
+        {
+            return;
+        }
+
+        if (set)
+        {
+            occupied[slot / 64] |= u64(1) << (slot % 64);
+        }
+        else
+        {
+            occupied[slot / 64] &= ~(u64(1) << (slot % 64));
+        }
+        setIndexed(speciesIndex, snapshot.species[slot], slot, set);
+        for (u8 i = 0; i < 4; i++)
+        {
+            setIndexed(moveIndex, snapshot.moves[i][slot], slot, set);
+        }
+    }
+
+    void PKFilterIndex::setIndexed(
+        std::unordered_map<u16, Bitmap>& index, u16 value, int slot, bool set)
+    {
+        Bitmap& bitmap = index[value];
+        if (bitmap.empty())
+        {
+            bitmap.resize(occupied.size());
+        }
+        if (set)
+        {
+            bitmap[slot / 64] |= u64(1) << (slot % 64);
+        }
+        else
+        {
+            bitmap[slot / 64] &= ~(u64(1) << (slot % 64));
+        }
+    }
+
+    void PKFilterIndex::update(int slot, const PKX& pk)
+    {
+        indexSlot(slot, false);
+        snapshot.update(slot, pk);
+        indexSlot(slot, true);
+    }
+
+    template <typename Value>
+    u64 PKFilterIndex::evaluateColumn(
+        const CompiledPKFilter::Check& check, size_t word, size_t count, Value&& value)
+    {
+        const size_t first = word * 64;
+        u64 ret            = 0;
+        if (check.op == CompiledPKFilter::Op::NotEqual)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                ret |= u64(check.inverse == (value(first + i) != check.operand)) << i;
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                ret |= u64(check.inverse == (value(first + i) < check.operand)) << i;
+            }
+        }
+        return ret;
+    }
+
+    u64 PKFilterIndex::evaluate(const CompiledPKFilter::Check& check, size_t word) const
+    {
+        const size_t count = std::min<size_t>(64, snapshot.size() - word * 64);
+        auto run           = [&](const auto& column)
+        {
+            return evaluateColumn(
+                check, word, count, [&column](size_t slot) { return column[slot]; });
+        };
+
+        switch (check.column)
+        {
+            case GENERATION:
+                return run(snapshot.generation);
+            case SPECIES:
+                return run(snapshot.species);
+            case FORM:
+                return run(snapshot.form);
+            case SHINY:
+                return run(snapshot.shiny);
+            case HELD_ITEM:
+                return run(snapshot.heldItem);
+            case LEVEL:
+                return run(snapshot.level);
+            case ABILITY:
+                return run(snapshot.ability);
+            case TSV:
+                return run(snapshot.TSV);
+            case NATURE:
+                return run(snapshot.nature);
+            case GENDER:
+                return run(snapshot.gender);
+            case HAS_RELEARN_MOVES:
+                return evaluateColumn(check, word, count,
+                    [this](size_t slot)
+                    { return u16(!(Generation(snapshot.generation[slot]) < Generation::SIX)); });
+            case BALL:
+                return run(snapshot.ball);
+            case LANGUAGE:
+                return run(snapshot.language);
+            case EGG:
+                return run(snapshot.egg);
+            default:
+                if (check.column >= IV)
+                {
+                    return run(snapshot.ivs[check.column - IV]);
+                }
+                else if (check.column >= RELEARN_MOVE)
+                {
+                    return run(snapshot.relearnMoves[check.column - RELEARN_MOVE]);
+                }
+                return run(snapshot.moves[check.column - MOVE]);
+        }
+    }
+
+    std::vector<int> PKFilterIndex::find(const CompiledPKFilter& filter) const
+    {
+        const size_t words = occupied.size();
+        Bitmap candidates  = occupied;
+
+        // Narrow things down with the bitmaps first. A species check is answered by them exactly;
+        // a move check only says that the move is somewhere, so it still gets evaluated
+        for (const auto& check : filter.checks)
+        {
+            const std::unordered_map<u16, Bitmap>* index = nullptr;
+            if (check.column == SPECIES)
+            {
+                index = &speciesIndex;
+            }
+            else if (check.column >= MOVE && check.column < MOVE + 4 && !check.inverse)
+            {
+                index = &moveIndex;
+            }
+            else
+            {
+                continue;
+            }
+
+            auto found = index->find(check.operand);
+            for (size_t word = 0; word < words; word++)
+            {
+                u64 bits = found == index->end() ? 0 : found->second[word];
+                candidates[word] &= check.inverse ? ~bits : bits;
+            }
+        }
+
+        std::vector<int> ret;
+        for (size_t word = 0; word < words; word++)
+        {
+            u64 bits = candidates[word];
+            for (auto check = filter.checks.begin(); bits != 0 && check != filter.checks.end();
+                 ++check)
+            {
+                if (check->column != SPECIES)
+                {
+                    bits &= evaluate(*check, word);
+                }
+            }
+            while (bits != 0)
+            {
+                ret.emplace_back(word * 64 + std::countr_zero(bits));
+                bits &= bits - 1;
+            }
+        }
+        return ret;
+    }
+}
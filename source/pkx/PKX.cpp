@@ -39,6 +39,50 @@
 #include "utils/random.hpp"
 #include "utils/VersionTables.hpp"
 
+namespace
+{
+    // A random PID out of those whose low byte is in [lowByteMin, lowByteMax], whose bits under
+    // bitMask (a subset of 0x00010001) match bits, and, if shiny, whose halves xor to the TSV.
+    // Every such PID is equally likely, so rejecting the ones that fail any further checks leaves
+    // the same distribution as rejecting fully random PIDs would. Shiny PIDs are built directly
+    // rather than waiting for one in 8192 or 65536 random ones
+    u32 randomPID(u32 lowByteMin, u32 lowByteMax, u32 bitMask, u32 bits, bool shiny, u16 tsv,
+        int psvShift)
+    {
+        u32 lowByte;
+        const u32 first = lowByteMin + ((lowByteMin ^ bits) & bitMask & 1);
+        if ((bitMask & 1) && first <= lowByteMax)
+        {
+            lowByte = first + 2 * pksm::randomNumber(0, (lowByteMax - first) / 2);
+        }
+        else
+        {
+            // Without a matching value the checks after this reject everything, as they always
+            // have in that case
+            lowByte = pksm::randomNumber(lowByteMin, lowByteMax);
+        }
+
+        const u32 low = pksm::randomNumber(0, 0xFF) << 8 | lowByte;
+        u32 high;
+        if (shiny)
+        {
+            high = (low ^ (u32(tsv) << psvShift) ^ pksm::randomNumber(0, (1 << psvShift) - 1)) &
+                   0xFFFF;
+        }
+        else
+        {
+            high = pksm::randomNumber(0, 0xFFFF);
+        }
+        // Bit 0 of the high half is one of the bits of the xor that shininess leaves free
+        if (bitMask & 0x10000)
+        {
+            high = (high & ~1u) | (bits >> 16 & 1);
+        }
+
+        return high << 16 | low;
+    }
+}
+
 namespace pksm
 {
     Gender PKX::genderFromRatio(u32 pid, u8 gt)
@@ -243,6 +287,25 @@ namespace pksm
         return table[row][col];
     }
 
+    u8 PKX::levelFromExp(u32 exp, u8 type) const
+    {
+        // The first level whose threshold hasn't been reached, found by binary search
+        u8 low = 1, high = 100;
+        while (low < high)
+        {
+            u8 mid = (low + high) / 2;
+            if (exp >= expTable(mid, type))
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
     void PKX::reorderMoves(void)
     {
         if (move(3) != Move::None && move(2) == Move::None)
@@ -374,7 +437,7 @@ namespace pksm
             u32 retId;
             do
             {
-                retId = pksm::randomNumber(0, 0xFFFFFFFF);
+                retId = randomPID(0, 0xFF, 0, 0, shiny, tsv, psvShift);
             }
             while (shiny != testShiny(retId));
 
@@ -419,9 +482,28 @@ namespace pksm
         bool g3unown  = (originGame <= GameVersion::LG || gen == Generation::THREE) &&
                        species == Species::Unown;
         u32 abilityBits = oldPid & (abilityNum == 2 ? 0x00010001 : 0);
+
+        // Gender only depends on the low byte
+        u32 lowByteMin = 0, lowByteMax = 0xFF;
+        if (genderType != 255 && genderType != 254 && genderType != 0 &&
+            gender != Gender::Genderless)
+        {
+            if (gender == Gender::Female)
+            {
+                lowByteMax = genderType - 1;
+            }
+            else
+            {
+                lowByteMin = genderType;
+            }
+        }
+        // Unown's form takes the place of the ability check
+        const u32 abilityMask = g3unown ? 0 : 0x00010001;
+
         while (true)
         {
-            u32 possiblePID = pksm::randomNumber(0, 0xFFFFFFFF);
+            u32 possiblePID = randomPID(
+                lowByteMin, lowByteMax, abilityMask, abilityBits, shiny, tsv, psvShift);
             if ((Generation)originGame <= Generation::FOUR && (possiblePID % 25) != size_t(nature))
             {
                 continue;
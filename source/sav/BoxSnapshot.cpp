@@ -0,0 +1,133 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "sav/BoxSnapshot.hpp"
+#include "sav/Sav.hpp"
+
+namespace pksm
+{
+    template <typename Function>
+    void BoxSnapshot::forEachColumn(Function&& function)
+    {
+        function(generation);
+        function(species);
+        function(form);
+        function(level);
+        function(shiny);
+        function(egg);
+        function(gender);
+        function(nature);
+        function(ability);
+        function(heldItem);
+        function(ball);
+        function(language);
+        function(PID);
+        function(TID);
+        function(SID);
+        function(TSV);
+        for (auto& column : ivs)
+        {
+            function(column);
+        }
+        for (auto& column : evs)
+        {
+            function(column);
+        }
+        for (auto& column : moves)
+        {
+            function(column);
+        }
+        for (auto& column : relearnMoves)
+        {
+            function(column);
+        }
+    }
+
+    BoxSnapshot::BoxSnapshot(const Sav& save) : slots(save.maxSlot())
+    {
+        forEachColumn([this](auto& column) { column.assign(slots, 0); });
+
+        int slot = 0;
+        save.forEachPkm(
+            [this, &slot](const auto& pk, u8 box, u8)
+            {
+                if (box != Sav::PARTY_BOX)
+                {
+                    if (pk.species() != Species::None)
+                    {
+                        read(slot, pk);
+                    }
+                    slot++;
+                }
+            });
+    }
+
+    // pk is whatever type forEachPkm reads the slot as. PKXView is final, so for those slots none
+    // of these calls go through the vtable. Gen 1-3 slots and ones read through pkm() are passed
+    // as their non-final PK class and still dispatch virtually
+    template <typename Pkm>
+    void BoxSnapshot::read(int slot, const Pkm& pk)
+    {
+        generation[slot] = u8(pk.generation());
+        species[slot]    = u16(pk.species());
+        form[slot]       = pk.alternativeForm();
+        level[slot]      = pk.level();
+        shiny[slot]      = pk.shiny();
+        egg[slot]        = pk.egg();
+        gender[slot]     = u8(pk.gender());
+        nature[slot]     = u8(pk.nature());
+        ability[slot]    = u16(pk.ability());
+        heldItem[slot]   = pk.heldItem();
+        ball[slot]       = u8(pk.ball());
+        language[slot]   = u8(pk.language());
+        PID[slot]        = pk.PID();
+        TID[slot]        = pk.TID();
+        SID[slot]        = pk.SID();
+        TSV[slot]        = pk.TSV();
+        for (u8 i = 0; i < 6; i++)
+        {
+            ivs[i][slot] = pk.iv(Stat(i));
+            evs[i][slot] = pk.ev(Stat(i));
+        }
+        for (u8 i = 0; i < 4; i++)
+        {
+            moves[i][slot]        = u16(pk.move(i));
+            relearnMoves[i][slot] = u16(pk.relearnMove(i));
+        }
+    }
+
+    void BoxSnapshot::update(int slot, const PKX& pk)
+    {
+        if (pk.species() != Species::None)
+        {
+            read(slot, pk);
+        }
+        else
+        {
+            forEachColumn([slot](auto& column) { column[slot] = 0; });
+        }
+    }
+}
@@ -0,0 +1,119 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "sav/DirtyBlocks.hpp"
+#include <algorithm>
+
+#ifndef _PKSMCORE_CONFIGURED
+#include "PKSMCORE_CONFIG.h"
+#endif
+
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+#include <atomic>
+#include <system_error>
+#include <thread>
+#include <vector>
+#endif
+
+namespace pksm
+{
+    void DirtyBlocks::mark(u32 offset, size_t length)
+    {
+        // The first block that ends after offset is the first one that can overlap
+        for (size_t i = std::upper_bound(ends.begin(), ends.begin() + count, offset) - ends.begin();
+             i < count && starts[i] < offset + length; i++)
+        {
+            dirty.set(i);
+        }
+    }
+
+    bool DirtyBlocks::resign(const std::function<void(size_t)>& checksum, size_t first, size_t last)
+    {
+        std::array<u8, MAX_BLOCKS> todo;
+        size_t todoCount = 0;
+        // Only needed for deciding whether to use threads
+        [[maybe_unused]] size_t bytes = 0;
+        for (size_t i = first; i < std::min(last, count); i++)
+        {
+            if (dirty[i])
+            {
+                todo[todoCount++] = i;
+                bytes             += ends[i] - starts[i];
+                dirty.reset(i);
+            }
+        }
+
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+        if (bytes >= PARALLEL_BYTES && todoCount > 1)
+        {
+            // Blocks vary from a few bytes to a few hundred kilobytes, so the biggest go first and
+            // every worker takes the next one that's left, so that none is left with a big one
+            // at the end
+            std::sort(todo.begin(), todo.begin() + todoCount,
+                [this](u8 a, u8 b) { return ends[a] - starts[a] > ends[b] - starts[b]; });
+
+            std::atomic<size_t> next = 0;
+            auto work                = [&next, &todo, todoCount, &checksum]()
+            {
+                for (size_t i = next++; i < todoCount; i = next++)
+                {
+                    checksum(todo[i]);
+                }
+            };
+
+            std::vector<std::thread> workers;
+            const size_t workerCount = std::min<size_t>(
+                {std::thread::hardware_concurrency(), todoCount, bytes / (PARALLEL_BYTES / 2)});
+            // The calling thread is one of them
+            for (size_t i = 1; i < workerCount; i++)
+            {
+                try
+                {
+                    workers.emplace_back(work);
+                }
+                catch (const std::system_error&)
+                {
+                    // Out of threads; the ones that did start will pick up the slack
+                    break;
+                }
+            }
+
+            work();
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+            return true;
+        }
+#endif
+
+        for (size_t i = 0; i < todoCount; i++)
+        {
+            checksum(todo[i]);
+        }
+        return todoCount != 0;
+    }
+}
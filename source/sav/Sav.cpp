@@ -53,7 +53,156 @@
 #include "sav/SavXY.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
+#include "utils/io.hpp"
 #include "utils/ValueConverter.hpp"
+#include <stdexcept>
+
+#ifndef _PKSMCORE_CONFIGURED
+#include "PKSMCORE_CONFIG.h"
+#endif
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define PKSMCORE_HAS_MMAP
+#endif
+
+namespace
+{
+    pksm::Sav::SlotSummary summarize(const auto& pk)
+    {
+        if (pk.species() == pksm::Species::None)
+        {
+            return {};
+        }
+        return {pk.species(), u8(pk.alternativeForm()), pk.level(), pk.shiny(), pk.egg()};
+    }
+
+    template <typename Done>
+    bool convertForward(const pksm::PKX&, pksm::Generation, pksm::Sav&, Done&)
+    {
+        return false;
+    }
+    template <typename Done>
+    bool convertForward(const pksm::PK1& pk, pksm::Generation target, pksm::Sav& save, Done& done);
+    template <typename Done>
+    bool convertForward(const pksm::PK2& pk, pksm::Generation target, pksm::Sav& save, Done& done);
+    template <typename Done>
+    bool convertForward(const pksm::PK3& pk, pksm::Generation target, pksm::Sav& save, Done& done);
+    template <typename Done>
+    bool convertForward(const pksm::PK4& pk, pksm::Generation target, pksm::Sav& save, Done& done);
+    template <typename Done>
+    bool convertForward(const pksm::PK5& pk, pksm::Generation target, pksm::Sav& save, Done& done);
+    template <typename Done>
+    bool convertForward(const pksm::PK6& pk, pksm::Generation target, pksm::Sav& save, Done& done);
+    template <typename Done>
+    bool convertForward(const pksm::PK7& pk, pksm::Generation target, pksm::Sav& save, Done& done);
+    template <typename Done>
+    bool convertForward(const pksm::PB7& pk, pksm::Generation target, pksm::Sav& save, Done& done);
+
+    // One step of convertForward: convert writes the next generation's Pokemon into a view over a
+    // zeroed stack buffer, which is either the result or converted further
+    template <typename Target, typename Done, typename Convert>
+    bool convertStep(pksm::Generation target, pksm::Sav& save, Done& done, const Convert& convert)
+    {
+        u8 buffer[Target::BOX_LENGTH] = {};
+        pksm::PKXView<Target> converted(buffer, false);
+        // Nothing converts to LGPE
+        if (target < converted.generation() || target == pksm::Generation::LGPE)
+        {
+            return false;
+        }
+        convert(converted);
+        if (converted.generation() == target)
+        {
+            done(converted);
+            return true;
+        }
+        return convertForward(converted, target, save, done);
+    }
+
+    // Converts pk to target through the same single-generation steps its convertToGN functions
+    // chain together, but with every step in a PKXView on the stack rather than a new PKX. If
+    // target is reached that way, calls done with the result and returns true. Gen 1 and 2 go
+    // through Gen 7 and LGPE goes to Gen 8, as they do there; backwards conversions return false
+    template <typename Done>
+    bool convertForward(const pksm::PK1& pk, pksm::Generation target, pksm::Sav& save, Done& done)
+    {
+        return convertStep<pksm::PK7>(
+            target, save, done, [&](pksm::PK7& pk7) { pk.convertToG7(pk7, save); });
+    }
+
+    template <typename Done>
+    bool convertForward(const pksm::PK2& pk, pksm::Generation target, pksm::Sav& save, Done& done)
+    {
+        return convertStep<pksm::PK7>(
+            target, save, done, [&](pksm::PK7& pk7) { pk.convertToG7(pk7, save); });
+    }
+
+    template <typename Done>
+    bool convertForward(const pksm::PK3& pk, pksm::Generation target, pksm::Sav& save, Done& done)
+    {
+        return convertStep<pksm::PK4>(
+            target, save, done, [&](pksm::PK4& pk4) { pk.convertToG4(pk4, save); });
+    }
+
+    template <typename Done>
+    bool convertForward(const pksm::PK4& pk, pksm::Generation target, pksm::Sav& save, Done& done)
+    {
+        return convertStep<pksm::PK5>(
+            target, save, done, [&](pksm::PK5& pk5) { pk.convertToG5(pk5, save); });
+    }
+
+    template <typename Done>
+    bool convertForward(const pksm::PK5& pk, pksm::Generation target, pksm::Sav& save, Done& done)
+    {
+        return convertStep<pksm::PK6>(
+            target, save, done, [&](pksm::PK6& pk6) { pk.convertToG6(pk6, save); });
+    }
+
+    template <typename Done>
+    bool convertForward(const pksm::PK6& pk, pksm::Generation target, pksm::Sav& save, Done& done)
+    {
+        return convertStep<pksm::PK7>(
+            target, save, done, [&](pksm::PK7& pk7) { pk.convertToG7(pk7, save); });
+    }
+
+    template <typename Done>
+    bool convertForward(const pksm::PK7& pk, pksm::Generation target, pksm::Sav& save, Done& done)
+    {
+        return convertStep<pksm::PK8>(
+            target, save, done, [&](pksm::PK8& pk8) { pk.convertToG8(pk8, save); });
+    }
+
+    template <typename Done>
+    bool convertForward(const pksm::PB7& pk, pksm::Generation target, pksm::Sav& save, Done& done)
+    {
+        return convertStep<pksm::PK8>(
+            target, save, done, [&](pksm::PK8& pk8) { pk.convertToG8(pk8, save); });
+    }
+
+    // SwSh saves have their xorpad removed in place as soon as they're loaded, so writing their
+    // memory straight through to the file would rewrite all of it without the pad
+    [[maybe_unused]] bool changedOnLoad(size_t length)
+    {
+        switch (length)
+        {
+            case pksm::SavSWSH::SIZE_G8SWSH:
+            case pksm::SavSWSH::SIZE_G8SWSH_1:
+            case pksm::SavSWSH::SIZE_G8SWSH_2:
+            case pksm::SavSWSH::SIZE_G8SWSH_2B:
+            case pksm::SavSWSH::SIZE_G8SWSH_3:
+            case pksm::SavSWSH::SIZE_G8SWSH_3A:
+            case pksm::SavSWSH::SIZE_G8SWSH_3B:
+            case pksm::SavSWSH::SIZE_G8SWSH_3C:
+                return true;
+            default:
+                return false;
+        }
+    }
+}
 
 namespace pksm
 {
@@ -104,8 +253,20 @@ namespace pksm
             case SavSWSH::SIZE_G8SWSH_3A:
             case SavSWSH::SIZE_G8SWSH_3B:
             case SavSWSH::SIZE_G8SWSH_3C:
-                ret = std::make_unique<SavSWSH>(dt, length);
+            {
+                auto swsh = std::make_unique<SavSWSH>(dt, length);
+                if (swsh->complete())
+                {
+                    ret = std::move(swsh);
+                }
+                else
+                {
+                    // Corrupted, or not a SwSh save at all. Put the xorpad that loading it removed
+                    // back so that the caller's data is left as it was
+                    pksm::crypto::swsh::applyXor(dt, length);
+                }
                 break;
+            }
             default:
                 ret = std::unique_ptr<Sav>(nullptr);
                 break;
@@ -119,6 +280,54 @@ namespace pksm
         return ret;
     }
 
+    std::unique_ptr<Sav> Sav::openFile(const std::string& path, OpenMode mode)
+    {
+#ifdef PKSMCORE_HAS_MMAP
+        int fd = open(path.c_str(), mode == OpenMode::WRITE_THROUGH ? O_RDWR : O_RDONLY);
+        if (fd < 0)
+        {
+            return nullptr;
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        const size_t size = info.st_size;
+        if (mode == OpenMode::WRITE_THROUGH && changedOnLoad(size))
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        const int flags = mode == OpenMode::WRITE_THROUGH ? MAP_SHARED : MAP_PRIVATE;
+        void* mapped    = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+        // The mapping keeps its own reference to the file
+        close(fd);
+        if (mapped == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        return getSave(
+            std::shared_ptr<u8[]>{static_cast<u8*>(mapped), [size](u8* p) { munmap(p, size); }},
+            size);
+#else
+        // Without a way to map it, edits can't go to the file by themselves
+        if (mode == OpenMode::WRITE_THROUGH)
+        {
+            return nullptr;
+        }
+
+        size_t size                = 0;
+        std::shared_ptr<u8[]> data = io::read(path, size);
+        return data ? getSave(data, size) : nullptr;
+#endif
+    }
+
     std::unique_ptr<Sav> Sav::checkGBType(const std::shared_ptr<u8[]>& dt, size_t length)
     {
         std::tuple<GameVersion, Language, bool> versionAndLanguage = Sav2::getVersion(dt);
@@ -293,6 +502,175 @@ namespace pksm
         return nullptr;
     }
 
+    std::vector<Sav::TransferredSlot> Sav::transferBoxes(
+        const Sav& source, u8 fromBox, u8 boxCount, u8 toBox, bool applyTrade)
+    {
+        using Result = TransferredSlot::Result;
+
+        // Found once up front, since nothing but this fills them in
+        const std::vector<SlotSummary> taken = scanBoxes();
+
+        const int boxSlots = generation() <= Generation::TWO ? maxSlot() / maxBoxes() : 30;
+        const int lastBox  = std::min(int(fromBox) + boxCount, source.maxBoxes());
+        size_t next        = size_t(toBox) * boxSlots;
+
+        std::vector<TransferredSlot> ret;
+        source.forEachPkm(
+            [&](const auto& pk, u8 box, u8 slot)
+            {
+                if (box == PARTY_BOX || box < fromBox || box >= lastBox ||
+                    pk.species() == Species::None)
+                {
+                    return;
+                }
+
+                TransferredSlot& report =
+                    ret.emplace_back(box, slot, 0, 0, Result::INVALID, invalidTransferReason(pk));
+                if (report.reason != BadTransferReason::OKAY)
+                {
+                    return;
+                }
+
+                while (next < taken.size() && taken[next].species != Species::None)
+                {
+                    next++;
+                }
+                if (next >= taken.size())
+                {
+                    report.result = Result::NO_SPACE;
+                    return;
+                }
+
+                auto write = [&](const PKX& converted)
+                {
+                    report.toBox  = next / boxSlots;
+                    report.toSlot = next % boxSlots;
+                    pkm(converted, report.toBox, report.toSlot, applyTrade);
+                    dex(converted);
+                    report.result = Result::TRANSFERRED;
+                    next++;
+                };
+
+                if (pk.generation() == generation())
+                {
+                    write(pk);
+                }
+                else if (!convertForward(pk, generation(), *this, write))
+                {
+                    // Backwards conversions still allocate every step through transfer()
+                    if (auto converted = transfer(pk))
+                    {
+                        write(*converted);
+                    }
+                    else
+                    {
+                        report.result = Result::NOT_CONVERTIBLE;
+                    }
+                }
+            });
+
+        if (generation() == Generation::LGPE)
+        {
+            // LGPE's boxes are one list without gaps, which fixBoxes closes up again. That keeps
+            // their order, so every slot moves down by the number of empty slots before it
+            std::vector<bool> filled(taken.size());
+            for (size_t i = 0; i < taken.size(); i++)
+            {
+                filled[i] = taken[i].species != Species::None;
+            }
+            for (const TransferredSlot& report : ret)
+            {
+                if (report.result == Result::TRANSFERRED)
+                {
+                    filled[report.toBox * boxSlots + report.toSlot] = true;
+                }
+            }
+
+            std::vector<size_t> packed(taken.size());
+            size_t count = 0;
+            for (size_t i = 0; i < taken.size(); i++)
+            {
+                packed[i] = count;
+                count     += filled[i] ? 1 : 0;
+            }
+            for (TransferredSlot& report : ret)
+            {
+                if (report.result == Result::TRANSFERRED)
+                {
+                    size_t slot   = packed[report.toBox * boxSlots + report.toSlot];
+                    report.toBox  = slot / boxSlots;
+                    report.toSlot = slot % boxSlots;
+                }
+            }
+        }
+        fixBoxes();
+
+        return ret;
+    }
+
+    void Sav::dex(const PKX& pk)
+    {
+        writeDex(pk);
+        dexChanged(pk.species());
+
+#ifdef _PKSMCORE_CHECK_DEX_SUMMARY
+        if (dexCache && dexCacheVersion == version())
+        {
+            const DexSummary recount = countDex();
+            if (recount.seen != dexCache->seen || recount.caught != dexCache->caught ||
+                recount.seenCount != dexCache->seenCount ||
+                recount.caughtCount != dexCache->caughtCount)
+            {
+                throw std::logic_error("Dex summary doesn't match the save after dex()");
+            }
+        }
+#endif
+    }
+
+    Sav::DexSummary Sav::countDex() const
+    {
+        DexSummary summary;
+        for (const auto& species : availableSpecies())
+        {
+            summary.seen[size_t(species)]   = speciesSeen(species);
+            summary.caught[size_t(species)] = speciesCaught(species);
+        }
+        summary.seenCount   = summary.seen.count();
+        summary.caughtCount = summary.caught.count();
+        return summary;
+    }
+
+    const Sav::DexSummary& Sav::dexSummary() const
+    {
+        if (!dexCache || dexCacheVersion != version())
+        {
+            dexCacheVersion = version();
+            dexCache        = countDex();
+        }
+        return *dexCache;
+    }
+
+    void Sav::dexChanged(Species species)
+    {
+        // Nothing to update if it hasn't been built yet, and nothing to count if the game doesn't
+        // have the species
+        if (!dexCache || dexCacheVersion != version() ||
+            !VersionTables::isAvailable(dexCacheVersion, species))
+        {
+            return;
+        }
+
+        DexSummary& summary = *dexCache;
+        const bool seen     = speciesSeen(species);
+        const bool caught   = speciesCaught(species);
+
+        summary.seenCount   += int(seen) - int(summary.seen[size_t(species)]);
+        summary.caughtCount += int(caught) - int(summary.caught[size_t(species)]);
+
+        summary.seen[size_t(species)]   = seen;
+        summary.caught[size_t(species)] = caught;
+    }
+
     void Sav::fixParty()
     {
         // Poor man's bubble sort-like thing
@@ -364,12 +742,12 @@ namespace pksm
         bool moveBad = false;
         for (int i = 0; i < 4; i++)
         {
-            if (availableMoves().count(pk.move(i)) == 0)
+            if (!isAvailable(pk.move(i)))
             {
                 moveBad = true;
                 break;
             }
-            if (availableMoves().count(pk.relearnMove(i)) == 0)
+            if (!isAvailable(pk.relearnMove(i)))
             {
                 moveBad = true;
                 break;
@@ -379,7 +757,7 @@ namespace pksm
         {
             return BadTransferReason::MOVE;
         }
-        if (availableSpecies().count(pk.species()) == 0)
+        if (!isAvailable(pk.species()))
         {
             return BadTransferReason::SPECIES;
         }
@@ -391,7 +769,7 @@ namespace pksm
         {
             return BadTransferReason::FORM;
         }
-        if (availableAbilities().count(pk.ability()) == 0)
+        if (!isAvailable(pk.ability()))
         {
             if (generation() > Generation::TWO && pk.generation() > Generation::TWO)
             {
@@ -407,7 +785,7 @@ namespace pksm
                                               ? (int)static_cast<const PK2&>(pk).heldItem2()
                                               : (int)ItemConverter::nationalToG2(pk.heldItem()));
             // Crystal only adds key items
-            if (VersionTables::availableItems(GameVersion::GD).count(heldItem2) == 0 ||
+            if (!VersionTables::isAvailable(GameVersion::GD, heldItem2) ||
                 (heldItem2 == 0 && pk.heldItem() != 0))
             {
                 return BadTransferReason::ITEM;
@@ -418,19 +796,19 @@ namespace pksm
             const int heldItem3 = pk.generation() == Generation::THREE
                                     ? (int)static_cast<const PK3&>(pk).heldItem3()
                                     : (int)ItemConverter::nationalToG3(pk.heldItem());
-            if (availableItems().count(heldItem3) == 0 || (heldItem3 == 0 && pk.heldItem() != 0))
+            if (!isAvailable(heldItem3) || (heldItem3 == 0 && pk.heldItem() != 0))
             {
                 return BadTransferReason::ITEM;
             }
         }
-        else if (availableItems().count((int)pk.heldItem()) == 0 ||
+        else if (!isAvailable((int)pk.heldItem()) ||
                  (pk.generation() == Generation::THREE &&
                      pk.heldItem() == ItemConverter::ITEM_NOT_CONVERTIBLE))
         {
             return BadTransferReason::ITEM;
         }
 
-        if (availableBalls().count(pk.ball()) == 0)
+        if (!isAvailable(pk.ball()))
         {
             if (generation() > Generation::TWO)
             {
@@ -439,4 +817,80 @@ namespace pksm
         }
         return BadTransferReason::OKAY;
     }
+
+    template <typename Pkm>
+    std::vector<Sav::SlotSummary> Sav::scanBoxesAs() const
+    {
+        // LGPE and SwSh keep party data for boxed Pokemon as well
+        constexpr bool partyBoxes = std::is_same_v<Pkm, PB7> || std::is_same_v<Pkm, PK8>;
+        // Species is in the first block of every format that gets here
+        constexpr size_t SpeciesOffset = 0x08;
+
+        std::vector<SlotSummary> ret(maxSlot());
+        for (int i = 0; i < maxSlot(); i++)
+        {
+            u8* data = boxSlotData(i / 30, i % 30);
+            if (!data)
+            {
+                ret[i] = summarize(static_cast<const Pkm&>(*pkm(i / 30, i % 30)));
+            }
+            else if (!Pkm::isEncrypted(data))
+            {
+                if (LittleEndian::convertTo<u16>(data + SpeciesOffset) != 0)
+                {
+                    ret[i] = summarize(PKXView<Pkm>(data, partyBoxes));
+                }
+            }
+            else
+            {
+                // Everything summarized is in the first two blocks, and empty slots only need the
+                // first. The rest of the buffer stays zeroed, so the view sees it as decrypted
+                u8 buffer[Pkm::BOX_LENGTH] = {};
+                Pkm::decryptBlocks(data, buffer, 0, 1);
+                if (LittleEndian::convertTo<u16>(buffer + SpeciesOffset) != 0)
+                {
+                    Pkm::decryptBlocks(data, buffer, 1, 2);
+                    ret[i] = summarize(PKXView<Pkm>(buffer, false));
+                }
+            }
+        }
+        return ret;
+    }
+
+    std::vector<Sav::SlotSummary> Sav::scanBoxes() const
+    {
+        switch (generation())
+        {
+            case Generation::FOUR:
+                return scanBoxesAs<PK4>();
+            case Generation::FIVE:
+                return scanBoxesAs<PK5>();
+            case Generation::SIX:
+                return scanBoxesAs<PK6>();
+            case Generation::SEVEN:
+                return scanBoxesAs<PK7>();
+            case Generation::LGPE:
+                return scanBoxesAs<PB7>();
+            case Generation::EIGHT:
+                return scanBoxesAs<PK8>();
+            case Generation::ONE:
+            case Generation::TWO:
+            case Generation::THREE:
+            case Generation::UNUSED:
+                break;
+        }
+
+        // Nothing before Gen 4 is stored in a form that can be partially read, so just convert
+        std::vector<SlotSummary> ret;
+        ret.reserve(maxSlot());
+        forEachPkm(
+            [&ret](const auto& pk, u8 box, u8)
+            {
+                if (box != PARTY_BOX)
+                {
+                    ret.emplace_back(summarize(pk));
+                }
+            });
+        return ret;
+    }
 }
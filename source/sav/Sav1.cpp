@@ -187,6 +187,11 @@ namespace pksm
         return StringUtils::getString1(data.get(), 0x2598, japanese ? 6 : 8, lang);
     }
 
+    size_t Sav1::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString1(data.get(), 0x2598, japanese ? 6 : 8, lang, {out, size});
+    }
+
     void Sav1::otName(const std::string_view& v)
     {
         StringUtils::setString1(data.get(), v, 0x2598, japanese ? 6 : 8, lang);
@@ -472,9 +477,9 @@ namespace pksm
         return PKX::getPKM<Generation::ONE>(nullptr, PK1Length());
     }
 
-    void Sav1::dex(const PKX& pk)
+    void Sav1::writeDex(const PKX& pk)
     {
-        if (!(availableSpecies().count(pk.species()) > 0))
+        if (!isAvailable(pk.species()))
         {
             return;
         }
@@ -510,18 +515,6 @@ namespace pksm
         FlagUtil::setFlag(data.get() + OFS_DEX_SEEN, ofs, flag & 7, seen);
     }
 
-    int Sav1::dexSeen() const
-    {
-        return std::count_if(availableSpecies().begin(), availableSpecies().end(),
-            [this](const auto& spec) { return getSeen(spec); });
-    }
-
-    int Sav1::dexCaught() const
-    {
-        return std::count_if(availableSpecies().begin(), availableSpecies().end(),
-            [this](const auto& spec) { return getCaught(spec); });
-    }
-
     u8 Sav1::partyCount() const
     {
         return data[OFS_PARTY];
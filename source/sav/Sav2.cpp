@@ -354,6 +354,12 @@ namespace pksm
             data.get(), OFS_NAME, japanese ? 6 : (korean ? 11 : 8), lang);
     }
 
+    size_t Sav2::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString2(
+            data.get(), OFS_NAME, japanese ? 6 : (korean ? 11 : 8), lang, {out, size});
+    }
+
     void Sav2::otName(const std::string_view& v)
     {
         StringUtils::setString2(data.get(), v, OFS_NAME, japanese ? 6 : (korean ? 11 : 8), lang);
@@ -676,9 +682,9 @@ namespace pksm
         return PKX::getPKM<Generation::TWO>(nullptr, PK2Length());
     }
 
-    void Sav2::dex(const PKX& pk)
+    void Sav2::writeDex(const PKX& pk)
     {
-        if (!(availableSpecies().count(pk.species()) > 0))
+        if (!isAvailable(pk.species()))
         {
             return;
         }
@@ -735,18 +741,6 @@ namespace pksm
         }
     }
 
-    int Sav2::dexSeen() const
-    {
-        return std::count_if(availableSpecies().begin(), availableSpecies().end(),
-            [this](const auto& spec) { return getSeen(spec); });
-    }
-
-    int Sav2::dexCaught() const
-    {
-        return std::count_if(availableSpecies().begin(), availableSpecies().end(),
-            [this](const auto& spec) { return getCaught(spec); });
-    }
-
     std::string Sav2::boxName(u8 box) const
     {
         int boxNameLength = korean ? 17 : 9;
@@ -754,6 +748,13 @@ namespace pksm
             data.get(), OFS_BOX_NAMES + (box * boxNameLength), boxNameLength, lang);
     }
 
+    size_t Sav2::boxName(u8 box, char* out, size_t size) const
+    {
+        int boxNameLength = korean ? 17 : 9;
+        return StringUtils::getString2(data.get(), OFS_BOX_NAMES + (box * boxNameLength),
+            boxNameLength, lang, {out, size});
+    }
+
     void Sav2::boxName(u8 box, const std::string_view& name)
     {
         int boxNameLength = korean ? 17 : 9;
@@ -125,6 +125,8 @@ namespace pksm
         : Sav(dt, 0x20000), seenFlagOffsets(std::forward<SmallVector<int, 3>&&>(flagOffsets))
     {
         loadBlocks();
+        dirtySectors.set();
+        unmirroredSectors.set();
 
         // Japanese games are limited to 5 character OT names; any unused characters are 0xFF.
         // 5 for JP, 7 for INT. There's always 1 terminator, thus we can check 0x6-0x7 being 0xFFFF
@@ -168,7 +170,7 @@ namespace pksm
         {
             int ofs   = ABO() + (i * SIZE_BLOCK);
             int index = blockOrder[i];
-            if (index == -1)
+            if (index == -1 || !dirtySectors[i])
             {
                 continue;
             }
@@ -177,14 +179,65 @@ namespace pksm
         }
 
         // Hall of Fame Checksums
+        if (dirtySectors[BLOCK_COUNT])
         {
             u16 chk = calculateChecksum({&data[0x1C000], SIZE_BLOCK_USED});
             LittleEndian::convertFrom<u16>(&data[0x1CFF4], chk);
         }
+        if (dirtySectors[BLOCK_COUNT + 1])
         {
             u16 chk = calculateChecksum({&data[0x1D000], SIZE_BLOCK_USED});
             LittleEndian::convertFrom<u16>(&data[0x1DFF4], chk);
         }
+        dirtySectors.reset();
+
+        if (mirrorSlots)
+        {
+            mirrorToOtherSlot();
+        }
+    }
+
+    void Sav3::markDirty(u32 offset, size_t length)
+    {
+        if (length == 0)
+        {
+            return;
+        }
+
+        const u32 activeStart = ABO() / SIZE_BLOCK;
+        for (u32 sector = offset / SIZE_BLOCK; sector <= (offset + length - 1) / SIZE_BLOCK;
+             sector++)
+        {
+            if (sector >= activeStart && sector < activeStart + BLOCK_COUNT)
+            {
+                dirtySectors.set(sector - activeStart);
+                unmirroredSectors.set(sector - activeStart);
+            }
+            // Hall of Fame
+            else if (sector == 0x1C || sector == 0x1D)
+            {
+                dirtySectors.set(BLOCK_COUNT + sector - 0x1C);
+            }
+        }
+    }
+
+    void Sav3::mirrorToOtherSlot(void)
+    {
+        const int otherABO = (activeSAV ^ 1) * SIZE_BLOCK * BLOCK_COUNT;
+        // Every sector of a save has the same counter, so any of them will do
+        const u32 counter  = LittleEndian::convertTo<u32>(&data[ABO() + 0xFFC]) + 1;
+        for (int i = 0; i < BLOCK_COUNT; i++)
+        {
+            // Sectors are copied whole, footer included, so the other save ends up with the same
+            // order as this one and sectors after the first copy only need copying once changed
+            if (unmirroredSectors[i])
+            {
+                std::copy_n(&data[ABO() + i * SIZE_BLOCK], SIZE_BLOCK,
+                    &data[otherABO + i * SIZE_BLOCK]);
+                LittleEndian::convertFrom<u32>(&data[otherABO + i * SIZE_BLOCK + 0xFFC], counter);
+            }
+        }
+        unmirroredSectors.reset();
     }
 
     u32 Sav3::securityKey(void) const
@@ -208,6 +261,7 @@ namespace pksm
     void Sav3::TID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[blockOfs[0] + 0xA], v);
+        markDirty(blockOfs[0] + 0xA, 2);
     }
 
     u16 Sav3::SID(void) const
@@ -218,6 +272,7 @@ namespace pksm
     void Sav3::SID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[blockOfs[0] + 0xC], v);
+        markDirty(blockOfs[0] + 0xC, 2);
     }
 
     GameVersion Sav3::version(void) const
@@ -237,6 +292,7 @@ namespace pksm
     void Sav3::gender(Gender v)
     {
         data[blockOfs[0] + 8] = u8(v);
+        markDirty(blockOfs[0] + 8);
     }
 
     Language Sav3::language(void) const
@@ -255,10 +311,17 @@ namespace pksm
         return StringUtils::getString3(data.get(), blockOfs[0], japanese ? 5 : 7, japanese);
     }
 
+    size_t Sav3::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString3(
+            data.get(), blockOfs[0], japanese ? 5 : 7, japanese, {out, size});
+    }
+
     void Sav3::otName(const std::string_view& v)
     {
         StringUtils::setString3(
             data.get(), v, blockOfs[0], japanese ? 5 : 7, japanese, japanese ? 5 : 7, 0xFF);
+        markDirty(blockOfs[0], japanese ? 5 : 7);
     }
 
     u32 Sav3::money(void) const
@@ -282,9 +345,11 @@ namespace pksm
             case Game::RS:
             case Game::E:
                 LittleEndian::convertFrom<u32>(&data[blockOfs[1] + 0x0490], v ^ securityKey());
+                markDirty(blockOfs[1] + 0x0490, 4);
                 break;
             case Game::FRLG:
                 LittleEndian::convertFrom<u32>(&data[blockOfs[1] + 0x0290], v ^ securityKey());
+                markDirty(blockOfs[1] + 0x0290, 4);
                 break;
             default:
                 break;
@@ -306,6 +371,7 @@ namespace pksm
         }
 
         LittleEndian::convertFrom<u16>(&data[blockOfs[0] + 0xEB8], v);
+        markDirty(blockOfs[0] + 0xEB8, 2);
     }
 
     // TODO:? BPEarned
@@ -342,6 +408,7 @@ namespace pksm
             start      = blockOfs[2];
         }
         FlagUtil::setFlag(data.get(), start + (flagNumber >> 3), flagNumber & 7, value);
+        markDirty(start + (flagNumber >> 3));
     }
 
     u8 Sav3::badges(void) const
@@ -381,6 +448,7 @@ namespace pksm
     void Sav3::playedHours(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[blockOfs[0] + 0xE], v);
+        markDirty(blockOfs[0] + 0xE, 2);
     }
 
     u8 Sav3::playedMinutes(void) const
@@ -391,6 +459,7 @@ namespace pksm
     void Sav3::playedMinutes(u8 v)
     {
         data[blockOfs[0] + 0x10] = v;
+        markDirty(blockOfs[0] + 0x10);
     }
 
     u8 Sav3::playedSeconds(void) const
@@ -401,6 +470,7 @@ namespace pksm
     void Sav3::playedSeconds(u8 v)
     {
         data[blockOfs[0] + 0x11] = v;
+        markDirty(blockOfs[0] + 0x11);
     }
 
     // TODO:? playedFrames, u8 at 0x12
@@ -413,6 +483,7 @@ namespace pksm
     void Sav3::currentBox(u8 v)
     {
         data[blockOfs[5]] = v;
+        markDirty(blockOfs[5]);
     }
 
     u32 Sav3::boxOffset(u8 box, u8 slot) const
@@ -460,6 +531,7 @@ namespace pksm
             auto pk3 = pk.partyClone();
             pk3->encrypt();
             std::ranges::copy(pk3->rawData(), &data[partyOffset(slot)]);
+            markDirty(partyOffset(slot), PK3::PARTY_LENGTH);
         }
     }
 
@@ -483,10 +555,13 @@ namespace pksm
                 u32 nextOffset = boxOffset(box + (slot + 1) / 30, (slot + 1) % 30);
                 std::ranges::copy(pk3->rawData().subspan(firstSize, PK3::BOX_LENGTH - firstSize),
                     &data[nextOffset & 0xFFFFF000]);
+                markDirty(offset, firstSize);
+                markDirty(nextOffset & 0xFFFFF000, PK3::BOX_LENGTH - firstSize);
             }
             else
             {
                 std::ranges::copy(pk3->rawData(), &data[offset]);
+                markDirty(offset, PK3::BOX_LENGTH);
             }
         }
     }
@@ -524,6 +599,7 @@ namespace pksm
     void Sav3::dexPIDUnown(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[PokeDex + 0x4], v);
+        markDirty(PokeDex + 0x4, 4);
     }
 
     u32 Sav3::dexPIDSpinda(void)
@@ -534,9 +610,10 @@ namespace pksm
     void Sav3::dexPIDSpinda(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[PokeDex + 0x8], v);
+        markDirty(PokeDex + 0x8, 4);
     }
 
-    void Sav3::dex(const PKX& pk)
+    void Sav3::writeDex(const PKX& pk)
     {
         if (!canSetDex(pk.species()) || pk.egg())
         {
@@ -578,6 +655,7 @@ namespace pksm
         int ofs          = bit >> 3;
         int caughtOffset = PokeDex + 0x10;
         FlagUtil::setFlag(data.get(), caughtOffset + ofs, bit & 7, caught);
+        markDirty(caughtOffset + ofs);
     }
 
     bool Sav3::getSeen(Species species) const
@@ -596,21 +674,10 @@ namespace pksm
         for (int o : seenFlagOffsets)
         {
             FlagUtil::setFlag(data.get(), o + ofs, bit & 7, seen);
+            markDirty(o + ofs);
         }
     }
 
-    int Sav3::dexSeen(void) const
-    {
-        return std::count_if(availableSpecies().begin(), availableSpecies().end(),
-            [this](const auto& spec) { return getSeen(spec); });
-    }
-
-    int Sav3::dexCaught(void) const
-    {
-        return std::count_if(availableSpecies().begin(), availableSpecies().end(),
-            [this](const auto& spec) { return getCaught(spec); });
-    }
-
     // Unused
     std::unique_ptr<WCX> Sav3::mysteryGift(int) const
     {
@@ -619,6 +686,12 @@ namespace pksm
 
     void Sav3::cryptBoxData(bool crypted)
     {
+        // Box blocks start at 5
+        for (int block = 5; block < BLOCK_COUNT; block++)
+        {
+            markDirty(blockOfs[block], SIZE_BLOCK_USED);
+        }
+
         for (u8 box = 0; box < maxBoxes(); box++)
         {
             for (u8 slot = 0; slot < 30; slot++)
@@ -654,10 +727,17 @@ namespace pksm
             data.get(), boxOffset(maxBoxes(), 0) + (box * 9), 9, japanese);
     }
 
+    size_t Sav3::boxName(u8 box, char* out, size_t size) const
+    {
+        return StringUtils::getString3(
+            data.get(), boxOffset(maxBoxes(), 0) + (box * 9), 9, japanese, {out, size});
+    }
+
     void Sav3::boxName(u8 box, const std::string_view& v)
     {
-        return StringUtils::setString3(
+        StringUtils::setString3(
             data.get(), v, boxOffset(maxBoxes(), 0) + (box * 9), 8, japanese, 9);
+        markDirty(boxOffset(maxBoxes(), 0) + (box * 9), 9);
     }
 
     u8 Sav3::boxWallpaper(u8 box) const
@@ -672,6 +752,7 @@ namespace pksm
         int offset   = boxOffset(maxBoxes(), 0);
         offset       += (maxBoxes() * 0x9) + box;
         data[offset] = v;
+        markDirty(offset);
     }
 
     u8 Sav3::partyCount(void) const
@@ -682,6 +763,7 @@ namespace pksm
     void Sav3::partyCount(u8 v)
     {
         data[blockOfs[1] + (game == Game::FRLG ? 0x34 : 0x234)] = v;
+        markDirty(blockOfs[1] + (game == Game::FRLG ? 0x34 : 0x234));
     }
 
     void Sav3::item(const Item& tItem, Pouch pouch, u16 slot)
@@ -695,30 +777,33 @@ namespace pksm
         {
             item.securityKey(securityKey());
         }
-        auto write = item.bytes();
+        int offset;
         switch (pouch)
         {
             case Pouch::NormalItem:
-                std::copy(write.begin(), write.end(), &data[OFS_PouchHeldItem + (slot * 4)]);
+                offset = OFS_PouchHeldItem;
                 break;
             case Pouch::KeyItem:
-                std::copy(write.begin(), write.end(), &data[OFS_PouchKeyItem + (slot * 4)]);
+                offset = OFS_PouchKeyItem;
                 break;
             case Pouch::Ball:
-                std::copy(write.begin(), write.end(), &data[OFS_PouchBalls + (slot * 4)]);
+                offset = OFS_PouchBalls;
                 break;
             case Pouch::TM:
-                std::copy(write.begin(), write.end(), &data[OFS_PouchTMHM + (slot * 4)]);
+                offset = OFS_PouchTMHM;
                 break;
             case Pouch::Berry:
-                std::copy(write.begin(), write.end(), &data[OFS_PouchBerry + (slot * 4)]);
+                offset = OFS_PouchBerry;
                 break;
             case Pouch::PCItem:
-                std::copy(write.begin(), write.end(), &data[OFS_PCItem + (slot * 4)]);
+                offset = OFS_PCItem;
                 break;
             default:
                 return;
         }
+        auto write = item.bytes();
+        std::copy(write.begin(), write.end(), &data[offset + (slot * 4)]);
+        markDirty(offset + (slot * 4), write.size());
     }
 
     std::unique_ptr<Item> Sav3::item(Pouch pouch, u16 slot) const
@@ -771,6 +856,7 @@ namespace pksm
             return;
         }
         LittleEndian::convertFrom<u16>(&data[blockOfs[0] + 0x98], v);
+        markDirty(blockOfs[0] + 0x98, 2);
     }
 
     u8 Sav3::rtcInitialHour(void) const
@@ -789,6 +875,7 @@ namespace pksm
             return;
         }
         data[blockOfs[0] + 0x98 + 2] = v;
+        markDirty(blockOfs[0] + 0x98 + 2);
     }
 
     u8 Sav3::rtcInitialMinute(void) const
@@ -807,6 +894,7 @@ namespace pksm
             return;
         }
         data[blockOfs[0] + 0x98 + 3] = v;
+        markDirty(blockOfs[0] + 0x98 + 3);
     }
 
     u8 Sav3::rtcInitialSecond(void) const
@@ -825,6 +913,7 @@ namespace pksm
             return;
         }
         data[blockOfs[0] + 0x98 + 4] = v;
+        markDirty(blockOfs[0] + 0x98 + 4);
     }
 
     u16 Sav3::rtcElapsedDay(void) const
@@ -843,6 +932,7 @@ namespace pksm
             return;
         }
         LittleEndian::convertFrom<u16>(&data[blockOfs[0] + 0xA0], v);
+        markDirty(blockOfs[0] + 0xA0, 2);
     }
 
     u8 Sav3::rtcElapsedHour(void) const
@@ -861,6 +951,7 @@ namespace pksm
             return;
         }
         data[blockOfs[0] + 0xA0 + 2] = v;
+        markDirty(blockOfs[0] + 0xA0 + 2);
     }
 
     u8 Sav3::rtcElapsedMinute(void) const
@@ -879,6 +970,7 @@ namespace pksm
             return;
         }
         data[blockOfs[0] + 0xA0 + 3] = v;
+        markDirty(blockOfs[0] + 0xA0 + 3);
     }
 
     u8 Sav3::rtcElapsedSecond(void) const
@@ -897,5 +989,6 @@ namespace pksm
             return;
         }
         data[blockOfs[0] + 0xA0 + 4] = v;
+        markDirty(blockOfs[0] + 0xA0 + 4);
     }
 }
@@ -204,6 +204,12 @@ namespace pksm
         return StringUtils::transString45(StringUtils::getString4(data.get(), Trainer1, 8));
     }
 
+    size_t Sav4::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString4(
+            data.get(), Trainer1, 8, {out, size}, StringUtils::transString45);
+    }
+
     void Sav4::otName(const std::string_view& v)
     {
         StringUtils::setString4(data.get(), StringUtils::transString45(v), Trainer1, 8);
@@ -349,17 +355,10 @@ namespace pksm
 
     void Sav4::cryptBoxData(bool crypted)
     {
+        // Boxes are padded, so they have to be done one at a time
         for (u8 box = 0; box < maxBoxes(); box++)
         {
-            for (u8 slot = 0; slot < 30; slot++)
-            {
-                std::unique_ptr<PKX> pk4 = PKX::getPKM<Generation::FOUR>(
-                    &data[boxOffset(box, slot)], PK4::BOX_LENGTH, true);
-                if (!crypted)
-                {
-                    pk4->encrypt();
-                }
-            }
+            PK4::cryptBoxData(&data[boxOffset(box, 0)], 30, false, crypted);
         }
     }
 
@@ -398,6 +397,13 @@ namespace pksm
             data.get(), boxOffset(18, 0) + box * 0x28 + (game == Game::HGSS ? 0x8 : 0), 9));
     }
 
+    size_t Sav4::boxName(u8 box, char* out, size_t size) const
+    {
+        return StringUtils::getString4(data.get(),
+            boxOffset(18, 0) + box * 0x28 + (game == Game::HGSS ? 0x8 : 0), 9, {out, size},
+            StringUtils::transString45);
+    }
+
     void Sav4::boxName(u8 box, const std::string_view& name)
     {
         StringUtils::setString4(data.get(), StringUtils::transString45(name),
@@ -464,9 +470,9 @@ namespace pksm
         data[Party - 4] = v;
     }
 
-    void Sav4::dex(const PKX& pk)
+    void Sav4::writeDex(const PKX& pk)
     {
-        if (!(availableSpecies().count(pk.species()) > 0) || pk.egg())
+        if (!isAvailable(pk.species()) || pk.egg())
         {
             return;
         }
@@ -603,43 +609,17 @@ namespace pksm
         data[languageFlags + (game == Game::DP ? dpl : u16(pk.species()))] |= (u8)(1 << lang);
     }
 
-    int Sav4::dexSeen(void) const
+    bool Sav4::speciesSeen(Species species) const
     {
-        int ret                     = 0;
         static constexpr int brSize = 0x40;
-        int ofs                     = PokeDex + 0x4;
-        for (const auto& spec : availableSpecies())
-        {
-            u16 i   = u16(spec);
-            int bit = i - 1;
-            int bd  = bit >> 3;
-            int bm  = bit & 7;
-
-            if ((1 << bm & data[ofs + bd + brSize]) != 0)
-            {
-                ret++;
-            }
-        }
-        return ret;
+        int bit                     = u16(species) - 1;
+        return (data[PokeDex + 0x4 + brSize + (bit >> 3)] >> (bit & 7) & 1) != 0;
     }
 
-    int Sav4::dexCaught(void) const
+    bool Sav4::speciesCaught(Species species) const
     {
-        int ret = 0;
-        int ofs = PokeDex + 0x4;
-        for (const auto& spec : availableSpecies())
-        {
-            u16 i   = u16(spec);
-            int bit = i - 1;
-            int bd  = bit >> 3;
-            int bm  = bit & 7;
-
-            if ((1 << bm & data[ofs + bd]) != 0)
-            {
-                ret++;
-            }
-        }
-        return ret;
+        int bit = u16(species) - 1;
+        return (data[PokeDex + 0x4 + (bit >> 3)] >> (bit & 7) & 1) != 0;
     }
 
     bool Sav4::checkInsertForm(SmallVector<u8, 0x20>& forms, u8 formNum)
@@ -42,6 +42,7 @@ namespace pksm
     void Sav5::TID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[Trainer1 + 0x14], v);
+        markDirty(Trainer1 + 0x14, 2);
     }
 
     u16 Sav5::SID(void) const
@@ -52,6 +53,7 @@ namespace pksm
     void Sav5::SID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[Trainer1 + 0x16], v);
+        markDirty(Trainer1 + 0x16, 2);
     }
 
     GameVersion Sav5::version(void) const
@@ -62,6 +64,7 @@ namespace pksm
     void Sav5::version(GameVersion v)
     {
         data[Trainer1 + 0x1F] = u8(v);
+        markDirty(Trainer1 + 0x1F);
     }
 
     Gender Sav5::gender(void) const
@@ -72,6 +75,7 @@ namespace pksm
     void Sav5::gender(Gender v)
     {
         data[Trainer1 + 0x21] = u8(v);
+        markDirty(Trainer1 + 0x21);
     }
 
     Language Sav5::language(void) const
@@ -82,6 +86,7 @@ namespace pksm
     void Sav5::language(Language v)
     {
         data[Trainer1 + 0x1E] = u8(v);
+        markDirty(Trainer1 + 0x1E);
     }
 
     std::string Sav5::otName(void) const
@@ -90,10 +95,17 @@ namespace pksm
             StringUtils::getString(data.get(), Trainer1 + 0x4, 8, u'\uFFFF'));
     }
 
+    size_t Sav5::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString(data.get(), Trainer1 + 0x4, 8, {out, size}, u'\uFFFF',
+            StringUtils::transString45);
+    }
+
     void Sav5::otName(const std::string_view& v)
     {
         StringUtils::setString(
             data.get(), StringUtils::transString45(v), Trainer1 + 0x4, 8, u'\uFFFF', 0);
+        markDirty(Trainer1 + 0x4, 8 * 2);
     }
 
     u32 Sav5::money(void) const
@@ -104,6 +116,7 @@ namespace pksm
     void Sav5::money(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[Trainer2], v);
+        markDirty(Trainer2, 4);
     }
 
     u32 Sav5::BP(void) const
@@ -114,6 +127,7 @@ namespace pksm
     void Sav5::BP(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[BattleSubway], v);
+        markDirty(BattleSubway, 4);
     }
 
     u8 Sav5::badges(void) const
@@ -135,6 +149,7 @@ namespace pksm
     void Sav5::playedHours(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[Trainer1 + 0x24], v);
+        markDirty(Trainer1 + 0x24, 2);
     }
 
     u8 Sav5::playedMinutes(void) const
@@ -145,6 +160,7 @@ namespace pksm
     void Sav5::playedMinutes(u8 v)
     {
         data[Trainer1 + 0x26] = v;
+        markDirty(Trainer1 + 0x26);
     }
 
     u8 Sav5::playedSeconds(void) const
@@ -155,6 +171,7 @@ namespace pksm
     void Sav5::playedSeconds(u8 v)
     {
         data[Trainer1 + 0x27] = v;
+        markDirty(Trainer1 + 0x27);
     }
 
     u8 Sav5::currentBox(void) const
@@ -165,6 +182,7 @@ namespace pksm
     void Sav5::currentBox(u8 v)
     {
         data[PCLayout] = v;
+        markDirty(PCLayout);
     }
 
     u8 Sav5::unlockedBoxes(void) const
@@ -175,6 +193,7 @@ namespace pksm
     void Sav5::unlockedBoxes(u8 v)
     {
         data[PCLayout + 0x3DD] = v;
+        markDirty(PCLayout + 0x3DD);
     }
 
     u32 Sav5::boxOffset(u8 box, u8 slot) const
@@ -199,6 +218,7 @@ namespace pksm
             auto pk5 = pk.partyClone();
             pk5->encrypt();
             std::ranges::copy(pk5->rawData(), &data[partyOffset(slot)]);
+            markDirty(partyOffset(slot), PK5::PARTY_LENGTH);
         }
     }
 
@@ -219,6 +239,7 @@ namespace pksm
 
             std::ranges::copy(
                 pk5->rawData().subspan(0, PK5::BOX_LENGTH), &data[boxOffset(box, slot)]);
+            markDirty(boxOffset(box, slot), PK5::BOX_LENGTH);
         }
     }
 
@@ -235,17 +256,11 @@ namespace pksm
 
     void Sav5::cryptBoxData(bool crypted)
     {
+        // Boxes are padded, so they have to be done one at a time
         for (u8 box = 0; box < maxBoxes(); box++)
         {
-            for (u8 slot = 0; slot < 30; slot++)
-            {
-                std::unique_ptr<PKX> pk5 = PKX::getPKM<Generation::FIVE>(
-                    &data[boxOffset(box, slot)], PK5::BOX_LENGTH, true);
-                if (!crypted)
-                {
-                    pk5->encrypt();
-                }
-            }
+            PK5::cryptBoxData(&data[boxOffset(box, 0)], 30, false, crypted);
+            markDirty(boxOffset(box, 0), 30 * PK5::BOX_LENGTH);
         }
     }
 
@@ -312,9 +327,9 @@ namespace pksm
         }
     }
 
-    void Sav5::dex(const PKX& pk)
+    void Sav5::writeDex(const PKX& pk)
     {
-        if (!(availableSpecies().count(pk.species()) > 0) || pk.egg())
+        if (!isAvailable(pk.species()) || pk.egg())
         {
             return;
         }
@@ -329,9 +344,11 @@ namespace pksm
 
         // Set the Species Owned Flag
         data[ofs + brSize * 0] |= (1 << (bit % 8));
+        markDirty(ofs + brSize * 0);
 
         // Set the [Species/Gender/Shiny] Seen Flag
         data[PokeDex + 0x8 + shiftoff + bit / 8] |= (1 << (bit & 7));
+        markDirty(PokeDex + 0x8 + shiftoff + bit / 8);
 
         // Set the Display flag if none are set
         bool displayed = false;
@@ -343,6 +360,7 @@ namespace pksm
         { // offset is already biased by brSize, reuse shiftoff but for the display
           // flags.
             data[ofs + brSize * (shift + 4)] |= (1 << (bit & 7));
+            markDirty(ofs + brSize * (shift + 4));
         }
 
         // Set the Language
@@ -358,6 +376,7 @@ namespace pksm
                 lang = 1;
             }
             data[PokeDexLanguageFlags + ((bit * 7 + lang) >> 3)] |= (1 << ((bit * 7 + lang) & 7));
+            markDirty(PokeDexLanguageFlags + ((bit * 7 + lang) >> 3));
         }
 
         // Formes
@@ -374,6 +393,7 @@ namespace pksm
 
         // Set Form Seen Flag
         data[formDex + formLen * shiny + (bit >> 3)] |= (1 << (bit & 7));
+        markDirty(formDex + formLen * shiny + (bit >> 3));
 
         // Set displayed Flag if necessary, check all flags
         for (int i = 0; i < fc; i++)
@@ -390,42 +410,26 @@ namespace pksm
         }
         bit                                                = f + pk.alternativeForm();
         data[formDex + formLen * (2 + shiny) + (bit >> 3)] |= (1 << (bit & 7));
+        markDirty(formDex + formLen * (2 + shiny) + (bit >> 3));
     }
 
-    int Sav5::dexSeen(void) const
+    bool Sav5::speciesSeen(Species species) const
     {
-        int ret = 0;
-        for (const auto& spec : availableSpecies())
+        int bit = u16(species) - 1;
+        for (int j = 0; j < 4; j++) // All seen flags: gender & shinies
         {
-            u16 i        = u16(spec);
-            int bitIndex = (i - 1) & 7;
-            for (int j = 0; j < 4; j++) // All seen flags: gender & shinies
+            if ((data[PokeDex + (0x5C + (j * 0x54)) + (bit >> 3)] >> (bit & 7) & 1) != 0)
             {
-                int ofs = PokeDex + (0x5C + (j * 0x54)) + ((i - 1) >> 3);
-                if ((data[ofs] >> bitIndex & 1) != 0)
-                {
-                    ret++;
-                    break;
-                }
+                return true;
             }
         }
-        return ret;
+        return false;
     }
 
-    int Sav5::dexCaught(void) const
+    bool Sav5::speciesCaught(Species species) const
     {
-        int ret = 0;
-        for (const auto& spec : availableSpecies())
-        {
-            u16 i        = u16(spec);
-            int bitIndex = (i - 1) & 7;
-            int ofs      = PokeDex + 0x8 + ((i - 1) >> 3);
-            if ((data[ofs] >> bitIndex & 1) != 0)
-            {
-                ret++;
-            }
-        }
-        return ret;
+        int bit = u16(species) - 1;
+        return (data[PokeDex + 0x8 + (bit >> 3)] >> (bit & 7) & 1) != 0;
     }
 
     void Sav5::mysteryGift(const WCX& wc, int& pos)
@@ -433,8 +437,10 @@ namespace pksm
         if (wc.generation() == Generation::FIVE)
         {
             data[WondercardFlags + (wc.ID() / 8)] |= 0x1 << (wc.ID() & 7);
+            markDirty(WondercardFlags + (wc.ID() / 8));
             std::copy(wc.rawData(), wc.rawData() + PGF::length,
                 &data[WondercardData + pos * PGF::length]);
+            markDirty(WondercardData + pos * PGF::length, PGF::length);
             pos = (pos + 1) % 12;
         }
     }
@@ -445,10 +451,17 @@ namespace pksm
             StringUtils::getString(data.get(), PCLayout + 0x28 * box + 4, 9, u'\uFFFF'));
     }
 
+    size_t Sav5::boxName(u8 box, char* out, size_t size) const
+    {
+        return StringUtils::getString(data.get(), PCLayout + 0x28 * box + 4, 9, {out, size},
+            u'\uFFFF', StringUtils::transString45);
+    }
+
     void Sav5::boxName(u8 box, const std::string_view& name)
     {
         StringUtils::setString(data.get(), StringUtils::transString45(name),
             PCLayout + 0x28 * box + 4, 9, u'\uFFFF', 0);
+        markDirty(PCLayout + 0x28 * box + 4, 9 * 2);
     }
 
     u8 Sav5::boxWallpaper(u8 box) const
@@ -459,6 +472,7 @@ namespace pksm
     void Sav5::boxWallpaper(u8 box, u8 v)
     {
         data[PCLayout + 0x3C4 + box] = v;
+        markDirty(PCLayout + 0x3C4 + box);
     }
 
     u8 Sav5::partyCount(void) const
@@ -469,6 +483,7 @@ namespace pksm
     void Sav5::partyCount(u8 v)
     {
         data[Party + 4] = v;
+        markDirty(Party + 4);
     }
 
     std::unique_ptr<PKX> Sav5::emptyPkm() const
@@ -505,6 +520,7 @@ namespace pksm
     {
         u32 seed = LittleEndian::convertTo<u32>(&data[0x1D290]);
         pksm::crypto::pkm::crypt<0xA90>(&data[WondercardFlags], seed);
+        markDirty(WondercardFlags, 0xA90);
     }
 
     std::unique_ptr<WCX> Sav5::mysteryGift(int pos) const
@@ -514,28 +530,31 @@ namespace pksm
 
     void Sav5::item(const Item& item, Pouch pouch, u16 slot)
     {
-        Item5 inject = static_cast<Item5>(item);
-        auto write   = inject.bytes();
+        int offset;
         switch (pouch)
         {
             case Pouch::NormalItem:
-                std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
+                offset = PouchHeldItem;
                 break;
             case Pouch::KeyItem:
-                std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
+                offset = PouchKeyItem;
                 break;
             case Pouch::TM:
-                std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
+                offset = PouchTMHM;
                 break;
             case Pouch::Medicine:
-                std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
+                offset = PouchMedicine;
                 break;
             case Pouch::Berry:
-                std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
+                offset = PouchBerry;
                 break;
             default:
                 return;
         }
+        Item5 inject = static_cast<Item5>(item);
+        auto write   = inject.bytes();
+        std::copy(write.begin(), write.end(), &data[offset + slot * 4]);
+        markDirty(offset + slot * 4, write.size());
     }
 
     std::unique_ptr<Item> Sav5::item(Pouch pouch, u16 slot) const
@@ -42,6 +42,7 @@ namespace pksm
     void Sav6::TID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[TrainerCard], v);
+        markDirty(TrainerCard, 2);
     }
 
     u16 Sav6::SID(void) const
@@ -52,6 +53,7 @@ namespace pksm
     void Sav6::SID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[TrainerCard + 2], v);
+        markDirty(TrainerCard + 2, 2);
     }
 
     GameVersion Sav6::version(void) const
@@ -62,6 +64,7 @@ namespace pksm
     void Sav6::version(GameVersion v)
     {
         data[TrainerCard + 4] = u8(v);
+        markDirty(TrainerCard + 4);
     }
 
     Gender Sav6::gender(void) const
@@ -72,6 +75,7 @@ namespace pksm
     void Sav6::gender(Gender v)
     {
         data[TrainerCard + 5] = u8(v);
+        markDirty(TrainerCard + 5);
     }
 
     u8 Sav6::subRegion(void) const
@@ -82,6 +86,7 @@ namespace pksm
     void Sav6::subRegion(u8 v)
     {
         data[TrainerCard + 0x26] = v;
+        markDirty(TrainerCard + 0x26);
     }
 
     u8 Sav6::country(void) const
@@ -92,6 +97,7 @@ namespace pksm
     void Sav6::country(u8 v)
     {
         data[TrainerCard + 0x27] = v;
+        markDirty(TrainerCard + 0x27);
     }
 
     u8 Sav6::consoleRegion(void) const
@@ -102,6 +108,7 @@ namespace pksm
     void Sav6::consoleRegion(u8 v)
     {
         data[TrainerCard + 0x2C] = v;
+        markDirty(TrainerCard + 0x2C);
     }
 
     Language Sav6::language(void) const
@@ -112,6 +119,7 @@ namespace pksm
     void Sav6::language(Language v)
     {
         data[TrainerCard + 0x2D] = u8(v);
+        markDirty(TrainerCard + 0x2D);
     }
 
     std::string Sav6::otName(void) const
@@ -120,9 +128,16 @@ namespace pksm
             StringUtils::getString(data.get(), TrainerCard + 0x48, 13));
     }
 
+    size_t Sav6::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString(data.get(), TrainerCard + 0x48, 13, {out, size}, u'\0',
+            StringUtils::transString67);
+    }
+
     void Sav6::otName(const std::string_view& v)
     {
         StringUtils::setString(data.get(), StringUtils::transString67(v), TrainerCard + 0x48, 13);
+        markDirty(TrainerCard + 0x48, 13 * 2);
     }
 
     u32 Sav6::money(void) const
@@ -133,6 +148,7 @@ namespace pksm
     void Sav6::money(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[Trainer2 + 0x8], v);
+        markDirty(Trainer2 + 0x8, 4);
     }
 
     u32 Sav6::BP(void) const
@@ -143,6 +159,7 @@ namespace pksm
     void Sav6::BP(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[Trainer2 + (game == Game::XY ? 0x3C : 0x30)], v);
+        markDirty(Trainer2 + (game == Game::XY ? 0x3C : 0x30), 4);
     }
 
     u8 Sav6::badges(void) const
@@ -164,6 +181,7 @@ namespace pksm
     void Sav6::playedHours(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[PlayTime], v);
+        markDirty(PlayTime, 2);
     }
 
     u8 Sav6::playedMinutes(void) const
@@ -174,6 +192,7 @@ namespace pksm
     void Sav6::playedMinutes(u8 v)
     {
         data[PlayTime + 2] = v;
+        markDirty(PlayTime + 2);
     }
 
     u8 Sav6::playedSeconds(void) const
@@ -184,6 +203,7 @@ namespace pksm
     void Sav6::playedSeconds(u8 v)
     {
         data[PlayTime + 3] = v;
+        markDirty(PlayTime + 3);
     }
 
     u8 Sav6::currentBox(void) const
@@ -194,6 +214,7 @@ namespace pksm
     void Sav6::currentBox(u8 v)
     {
         data[LastViewedBox] = v;
+        markDirty(LastViewedBox);
     }
 
     u8 Sav6::unlockedBoxes(void) const
@@ -204,6 +225,7 @@ namespace pksm
     void Sav6::unlockedBoxes(u8 v)
     {
         data[LastViewedBox - 1] = v;
+        markDirty(LastViewedBox - 1);
     }
 
     u32 Sav6::boxOffset(u8 box, u8 slot) const
@@ -228,6 +250,7 @@ namespace pksm
             auto pk6 = pk.partyClone();
             pk6->encrypt();
             std::ranges::copy(pk6->rawData(), &data[partyOffset(slot)]);
+            markDirty(partyOffset(slot), PK6::PARTY_LENGTH);
         }
     }
 
@@ -248,6 +271,7 @@ namespace pksm
 
             std::ranges::copy(
                 pkm->rawData().subspan(0, PK6::BOX_LENGTH), &data[boxOffset(box, slot)]);
+            markDirty(boxOffset(box, slot), PK6::BOX_LENGTH);
         }
     }
 
@@ -340,18 +364,8 @@ namespace pksm
 
     void Sav6::cryptBoxData(bool crypted)
     {
-        for (u8 box = 0; box < maxBoxes(); box++)
-        {
-            for (u8 slot = 0; slot < 30; slot++)
-            {
-                std::unique_ptr<PKX> pk6 = PKX::getPKM<Generation::SIX>(
-                    &data[boxOffset(box, slot)], PK6::BOX_LENGTH, true);
-                if (!crypted)
-                {
-                    pk6->encrypt();
-                }
-            }
-        }
+        PK6::cryptBoxData(&data[boxOffset(0, 0)], maxBoxes() * 30, false, crypted);
+        markDirty(boxOffset(0, 0), maxBoxes() * 30 * PK6::BOX_LENGTH);
     }
 
     int Sav6::dexFormIndex(int species, int formct) const
@@ -539,9 +553,9 @@ namespace pksm
         }
     }
 
-    void Sav6::dex(const PKX& pk)
+    void Sav6::writeDex(const PKX& pk)
     {
-        if (!(availableSpecies().count(pk.species()) > 0) || pk.egg())
+        if (!isAvailable(pk.species()) || pk.egg())
         {
             return;
         }
@@ -565,14 +579,17 @@ namespace pksm
         if (pk.version() < GameVersion::X && bit < 649 && game != Game::ORAS)
         { // Species: 1-649 for X/Y, and not for ORAS; Set the Foreign Owned Flag
             data[ofs + 0x644] |= mask;
+            markDirty(ofs + 0x644);
         }
         else if (pk.version() >= GameVersion::X || game == Game::ORAS)
         { // Set Native Owned Flag (should always happen)
             data[ofs + (brSize * 0)] |= mask;
+            markDirty(ofs + (brSize * 0));
         }
 
         // Set the [Species/Gender/Shiny] Seen Flag
         data[ofs + shiftoff] |= mask;
+        markDirty(ofs + shiftoff);
 
         // Set the Display flag if none are set
         bool displayed = false;
@@ -584,6 +601,7 @@ namespace pksm
         { // offset is already biased by brSize, reuse shiftoff but for the display
           // flags.
             data[ofs + brSize * 4 + shiftoff] |= mask;
+            markDirty(ofs + brSize * 4 + shiftoff);
         }
 
         // Set the Language
@@ -592,12 +610,14 @@ namespace pksm
             lang = 1;
         }
         data[PokeDexLanguageFlags + (bit * 7 + lang) / 8] |= (u8)(1 << ((bit * 7 + lang) % 8));
+        markDirty(PokeDexLanguageFlags + (bit * 7 + lang) / 8);
 
         // Set DexNav count (only if not encountered previously)
         if (game == Game::ORAS &&
             LittleEndian::convertTo<u16>(&data[EncounterCount + (u16(pk.species()) - 1) * 2]) == 0)
         {
             LittleEndian::convertFrom<u16>(&data[EncounterCount + (u16(pk.species()) - 1) * 2], 1);
+            markDirty(EncounterCount + (u16(pk.species()) - 1) * 2, 2);
         }
 
         // Set Form flags
@@ -614,6 +634,7 @@ namespace pksm
 
         // Set Form Seen Flag
         data[formDex + formLen * shiny + bit / 8] |= (u8)(1 << (bit % 8));
+        markDirty(formDex + formLen * shiny + bit / 8);
 
         // Set Displayed Flag if necessary, check all flags
         for (int i = 0; i < fc; i++)
@@ -630,42 +651,26 @@ namespace pksm
         }
         bit                                             = f + pk.alternativeForm();
         data[formDex + formLen * (2 + shiny) + bit / 8] |= (u8)(1 << (bit % 8));
+        markDirty(formDex + formLen * (2 + shiny) + bit / 8);
     }
 
-    int Sav6::dexSeen(void) const
+    bool Sav6::speciesSeen(Species species) const
     {
-        int ret = 0;
-        for (const auto& spec : availableSpecies())
+        int bit = u16(species) - 1;
+        for (int j = 0; j < 4; j++) // All seen flags: gender & shinies
         {
-            u16 i        = u16(spec);
-            int bitIndex = (i - 1) & 7;
-            for (int j = 0; j < 4; j++) // All seen flags: gender & shinies
+            if ((data[PokeDex + (0x68 + (j * 0x60)) + (bit >> 3)] >> (bit & 7) & 1) != 0)
             {
-                int ofs = PokeDex + (0x68 + (j * 0x60)) + ((i - 1) >> 3);
-                if ((data[ofs] >> bitIndex & 1) != 0)
-                {
-                    ret++;
-                    break;
-                }
+                return true;
             }
         }
-        return ret;
+        return false;
     }
 
-    int Sav6::dexCaught(void) const
+    bool Sav6::speciesCaught(Species species) const
     {
-        int ret = 0;
-        for (const auto& spec : availableSpecies())
-        {
-            u16 i        = u16(spec);
-            int bitIndex = (i - 1) & 7;
-            int ofs      = PokeDex + 0x8 + ((i - 1) >> 3);
-            if ((data[ofs] >> bitIndex & 1) != 0)
-            {
-                ret++;
-            }
-        }
-        return ret;
+        int bit = u16(species) - 1;
+        return (data[PokeDex + 0x8 + (bit >> 3)] >> (bit & 7) & 1) != 0;
     }
 
     void Sav6::mysteryGift(const WCX& wc, int& pos)
@@ -673,13 +678,17 @@ namespace pksm
         if (wc.generation() == Generation::SIX)
         {
             data[WondercardFlags + wc.ID() / 8] |= 0x1 << (wc.ID() % 8);
+            markDirty(WondercardFlags + wc.ID() / 8);
             std::copy(wc.rawData(), wc.rawData() + WC6::length,
                 &data[WondercardData + WC6::length * pos]);
+            markDirty(WondercardData + WC6::length * pos, WC6::length);
             if (game == Game::ORAS && wc.ID() == 2048 && wc.object() == 726)
             {
                 static constexpr u32 EON_MAGIC = 0x225D73C2;
                 LittleEndian::convertFrom<u32>(&data[0x319B8], EON_MAGIC);
+                markDirty(0x319B8, 4);
                 LittleEndian::convertFrom<u32>(&data[0x319DE], EON_MAGIC);
+                markDirty(0x319DE, 4);
             }
             pos = (pos + 1) % 24;
         }
@@ -691,10 +700,17 @@ namespace pksm
             StringUtils::getString(data.get(), PCLayout + 0x22 * box, 17));
     }
 
+    size_t Sav6::boxName(u8 box, char* out, size_t size) const
+    {
+        return StringUtils::getString(data.get(), PCLayout + 0x22 * box, 17, {out, size}, u'\0',
+            StringUtils::transString67);
+    }
+
     void Sav6::boxName(u8 box, const std::string_view& name)
     {
         StringUtils::setString(
             data.get(), StringUtils::transString67(name), PCLayout + 0x22 * box, 17);
+        markDirty(PCLayout + 0x22 * box, 17 * 2);
     }
 
     u8 Sav6::boxWallpaper(u8 box) const
@@ -705,6 +721,7 @@ namespace pksm
     void Sav6::boxWallpaper(u8 box, u8 v)
     {
         data[0x4400 + 1054 + box] = v;
+        markDirty(0x4400 + 1054 + box);
     }
 
     u8 Sav6::partyCount(void) const
@@ -715,6 +732,7 @@ namespace pksm
     void Sav6::partyCount(u8 v)
     {
         data[Party + 6 * PK6::PARTY_LENGTH] = v;
+        markDirty(Party + 6 * PK6::PARTY_LENGTH);
     }
 
     std::unique_ptr<PKX> Sav6::emptyPkm() const
@@ -754,28 +772,31 @@ namespace pksm
 
     void Sav6::item(const Item& item, Pouch pouch, u16 slot)
     {
-        Item6 inject = static_cast<Item6>(item);
-        auto write   = inject.bytes();
+        int offset;
         switch (pouch)
         {
             case Pouch::NormalItem:
-                std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
+                offset = PouchHeldItem;
                 break;
             case Pouch::KeyItem:
-                std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
+                offset = PouchKeyItem;
                 break;
             case Pouch::TM:
-                std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
+                offset = PouchTMHM;
                 break;
             case Pouch::Medicine:
-                std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
+                offset = PouchMedicine;
                 break;
             case Pouch::Berry:
-                std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
+                offset = PouchBerry;
                 break;
             default:
                 return;
         }
+        Item6 inject = static_cast<Item6>(item);
+        auto write   = inject.bytes();
+        std::copy(write.begin(), write.end(), &data[offset + slot * 4]);
+        markDirty(offset + slot * 4, write.size());
     }
 
     std::unique_ptr<Item> Sav6::item(Pouch pouch, u16 slot) const
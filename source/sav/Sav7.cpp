@@ -41,6 +41,7 @@ namespace pksm
     void Sav7::TID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[TrainerCard], v);
+        markDirty(TrainerCard, 2);
     }
 
     u16 Sav7::SID(void) const
@@ -51,6 +52,7 @@ namespace pksm
     void Sav7::SID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[TrainerCard + 2], v);
+        markDirty(TrainerCard + 2, 2);
     }
 
     GameVersion Sav7::version(void) const
@@ -61,6 +63,7 @@ namespace pksm
     void Sav7::version(GameVersion v)
     {
         data[TrainerCard + 4] = u8(v);
+        markDirty(TrainerCard + 4);
     }
 
     Gender Sav7::gender(void) const
@@ -71,6 +74,7 @@ namespace pksm
     void Sav7::gender(Gender v)
     {
         data[TrainerCard + 5] = u8(v);
+        markDirty(TrainerCard + 5);
     }
 
     u8 Sav7::subRegion(void) const
@@ -81,6 +85,7 @@ namespace pksm
     void Sav7::subRegion(u8 v)
     {
         data[TrainerCard + 0x2E] = v;
+        markDirty(TrainerCard + 0x2E);
     }
 
     u8 Sav7::country(void) const
@@ -91,6 +96,7 @@ namespace pksm
     void Sav7::country(u8 v)
     {
         data[TrainerCard + 0x2F] = v;
+        markDirty(TrainerCard + 0x2F);
     }
 
     u8 Sav7::consoleRegion(void) const
@@ -101,6 +107,7 @@ namespace pksm
     void Sav7::consoleRegion(u8 v)
     {
         data[TrainerCard + 0x34] = v;
+        markDirty(TrainerCard + 0x34);
     }
 
     Language Sav7::language(void) const
@@ -111,6 +118,7 @@ namespace pksm
     void Sav7::language(Language v)
     {
         data[TrainerCard + 0x35] = u8(v);
+        markDirty(TrainerCard + 0x35);
     }
 
     std::string Sav7::otName(void) const
@@ -119,10 +127,16 @@ namespace pksm
             StringUtils::getString(data.get(), TrainerCard + 0x38, 13));
     }
 
+    size_t Sav7::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString(data.get(), TrainerCard + 0x38, 13, {out, size}, u'\0',
+            StringUtils::transString67);
+    }
+
     void Sav7::otName(const std::string_view& v)
     {
-        return StringUtils::setString(
-            data.get(), StringUtils::transString67(v), TrainerCard + 0x38, 13);
+        StringUtils::setString(data.get(), StringUtils::transString67(v), TrainerCard + 0x38, 13);
+        markDirty(TrainerCard + 0x38, 13 * 2);
     }
 
     u32 Sav7::money(void) const
@@ -133,6 +147,7 @@ namespace pksm
     void Sav7::money(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[Misc + 0x4], v > 9999999 ? 9999999 : v);
+        markDirty(Misc + 0x4, 4);
     }
 
     u32 Sav7::BP(void) const
@@ -143,6 +158,7 @@ namespace pksm
     void Sav7::BP(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[Misc + 0x11C], v > 9999 ? 9999 : v);
+        markDirty(Misc + 0x11C, 4);
     }
 
     u8 Sav7::badges(void) const
@@ -164,6 +180,7 @@ namespace pksm
     void Sav7::playedHours(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[PlayTime], v);
+        markDirty(PlayTime, 2);
     }
 
     u8 Sav7::playedMinutes(void) const
@@ -174,6 +191,7 @@ namespace pksm
     void Sav7::playedMinutes(u8 v)
     {
         data[PlayTime + 2] = v;
+        markDirty(PlayTime + 2);
     }
 
     u8 Sav7::playedSeconds(void) const
@@ -184,6 +202,7 @@ namespace pksm
     void Sav7::playedSeconds(u8 v)
     {
         data[PlayTime + 3] = v;
+        markDirty(PlayTime + 3);
     }
 
     u8 Sav7::currentBox(void) const
@@ -194,6 +213,7 @@ namespace pksm
     void Sav7::currentBox(u8 v)
     {
         data[LastViewedBox] = v;
+        markDirty(LastViewedBox);
     }
 
     u8 Sav7::unlockedBoxes(void) const
@@ -204,6 +224,7 @@ namespace pksm
     void Sav7::unlockedBoxes(u8 v)
     {
         data[LastViewedBox - 2] = v;
+        markDirty(LastViewedBox - 2);
     }
 
     u32 Sav7::boxOffset(u8 box, u8 slot) const
@@ -228,6 +249,7 @@ namespace pksm
             auto pk7 = pk.partyClone();
             pk7->encrypt();
             std::ranges::copy(pk7->rawData(), &data[partyOffset(slot)]);
+            markDirty(partyOffset(slot), PK7::PARTY_LENGTH);
         }
     }
 
@@ -248,6 +270,7 @@ namespace pksm
 
             std::ranges::copy(
                 pkm->rawData().subspan(0, PK7::BOX_LENGTH), &data[boxOffset(box, slot)]);
+            markDirty(boxOffset(box, slot), PK7::BOX_LENGTH);
         }
     }
 
@@ -286,18 +309,8 @@ namespace pksm
 
     void Sav7::cryptBoxData(bool crypted)
     {
-        for (u8 box = 0; box < maxBoxes(); box++)
-        {
-            for (u8 slot = 0; slot < 30; slot++)
-            {
-                std::unique_ptr<PKX> pk7 = PKX::getPKM<Generation::SEVEN>(
-                    &data[boxOffset(box, slot)], PK7::BOX_LENGTH, true);
-                if (!crypted)
-                {
-                    pk7->encrypt();
-                }
-            }
-        }
+        PK7::cryptBoxData(&data[boxOffset(0, 0)], maxBoxes() * 30, false, crypted);
+        markDirty(boxOffset(0, 0), maxBoxes() * 30 * PK7::BOX_LENGTH);
     }
 
     void Sav7::setDexFlags(int index, int gender, int shiny, int baseSpecies)
@@ -312,6 +325,7 @@ namespace pksm
 
         int brSeen              = shift * brSize;
         data[ofs + brSeen + bd] |= 1 << bm;
+        markDirty(ofs + brSeen + bd);
 
         bool displayed = false;
         for (u8 i = 0; i < 4; i++)
@@ -334,6 +348,7 @@ namespace pksm
         }
 
         data[ofs + (4 + shift) * brSize + bd] |= (1 << bm);
+        markDirty(ofs + (4 + shift) * brSize + bd);
     }
 
     int Sav7::getDexFlags(int index, int baseSpecies) const
@@ -426,9 +441,9 @@ namespace pksm
         return true;
     }
 
-    void Sav7::dex(const PKX& pk)
+    void Sav7::writeDex(const PKX& pk)
     {
-        if (!(availableSpecies().count(pk.species()) > 0) || pk.egg())
+        if (!isAvailable(pk.species()) || pk.egg())
         {
             return;
         }
@@ -450,16 +465,20 @@ namespace pksm
             { // Already 2
                 LittleEndian::convertFrom<u32>(
                     &data[PokeDex + 0x8E8 + shift * 4], pk.encryptionConstant());
+                markDirty(PokeDex + 0x8E8 + shift * 4, 4);
                 data[PokeDex + 0x84] |= (u8)(1 << shift);
+                markDirty(PokeDex + 0x84);
             }
             else if ((data[PokeDex + 0x84] & (1 << shift)) == 0)
             {                                             // Not yet 1
                 data[PokeDex + 0x84] |= (u8)(1 << shift); // 1
+                markDirty(PokeDex + 0x84);
             }
         }
 
         int off        = PokeDex + 0x08 + 0x80;
         data[off + bd] |= 1 << bm;
+        markDirty(off + bd);
 
         int formstart = pk.alternativeForm();
         int formend   = formstart;
@@ -507,53 +526,38 @@ namespace pksm
             if (lbit >> 3 < 920)
             {
                 data[PokeDexLanguageFlags + (lbit >> 3)] |= (1 << (lbit & 7));
+                markDirty(PokeDexLanguageFlags + (lbit >> 3));
             }
         }
     }
 
-    int Sav7::dexSeen(void) const
+    bool Sav7::speciesSeen(Species species) const
     {
-        int ret = 0;
-        for (const auto& spec : availableSpecies())
+        int forms = formCount(species);
+        for (int form = 0; form < forms; form++)
         {
-            u16 species = u16(spec);
-            int forms   = formCount(spec);
-            for (int form = 0; form < forms; form++)
-            {
-                int dexForms = form == 0 ? -1
-                                         : dexFormIndex(species, forms,
-                                               u16(VersionTables::maxSpecies(version())) - 1);
+            int dexForms = form == 0 ? -1
+                                     : dexFormIndex(u16(species), forms,
+                                           u16(VersionTables::maxSpecies(version())) - 1);
 
-                int index = species - 1;
-                if (dexForms >= 0)
-                {
-                    index = dexForms + form;
-                }
+            int index = u16(species) - 1;
+            if (dexForms >= 0)
+            {
+                index = dexForms + form;
+            }
 
-                if (getDexFlags(index, species) > 0)
-                {
-                    ret++;
-                    break;
-                }
+            if (getDexFlags(index, u16(species) - 1) > 0)
+            {
+                return true;
             }
         }
-        return ret;
+        return false;
     }
 
-    int Sav7::dexCaught(void) const
+    bool Sav7::speciesCaught(Species species) const
     {
-        int ret = 0;
-        for (const auto& spec : availableSpecies())
-        {
-            u16 i        = u16(spec);
-            int bitIndex = (i - 1) & 7;
-            int ofs      = PokeDex + 0x88 + ((i - 1) >> 3);
-            if ((data[ofs] >> bitIndex & 1) != 0)
-            {
-                ret++;
-            }
-        }
-        return ret;
+        int bit = u16(species) - 1;
+        return (data[PokeDex + 0x88 + (bit >> 3)] >> (bit & 7) & 1) != 0;
     }
 
     void Sav7::mysteryGift(const WCX& wc, int& pos)
@@ -561,8 +565,10 @@ namespace pksm
         if (wc.generation() == Generation::SEVEN)
         {
             data[WondercardFlags + wc.ID() / 8] |= 0x1 << (wc.ID() % 8);
+            markDirty(WondercardFlags + wc.ID() / 8);
             std::copy(wc.rawData(), wc.rawData() + WC7::length,
                 &data[WondercardData + WC7::length * pos]);
+            markDirty(WondercardData + WC7::length * pos, WC7::length);
             pos = (pos + 1) % maxWondercards();
         }
     }
@@ -573,10 +579,17 @@ namespace pksm
             StringUtils::getString(data.get(), PCLayout + 0x22 * box, 17));
     }
 
+    size_t Sav7::boxName(u8 box, char* out, size_t size) const
+    {
+        return StringUtils::getString(data.get(), PCLayout + 0x22 * box, 17, {out, size}, u'\0',
+            StringUtils::transString67);
+    }
+
     void Sav7::boxName(u8 box, const std::string_view& name)
     {
         StringUtils::setString(
             data.get(), StringUtils::transString67(name), PCLayout + 0x22 * box, 17);
+        markDirty(PCLayout + 0x22 * box, 17 * 2);
     }
 
     u8 Sav7::boxWallpaper(u8 box) const
@@ -587,6 +600,7 @@ namespace pksm
     void Sav7::boxWallpaper(u8 box, u8 v)
     {
         data[PCLayout + 1472 + box] = v;
+        markDirty(PCLayout + 1472 + box);
     }
 
     u8 Sav7::partyCount(void) const
@@ -597,6 +611,7 @@ namespace pksm
     void Sav7::partyCount(u8 v)
     {
         data[Party + 6 * PK7::PARTY_LENGTH] = v;
+        markDirty(Party + 6 * PK7::PARTY_LENGTH);
     }
 
     std::unique_ptr<PKX> Sav7::emptyPkm() const
@@ -636,34 +651,37 @@ namespace pksm
 
     void Sav7::item(const Item& item, Pouch pouch, u16 slot)
     {
-        Item7 inject = static_cast<Item7>(item);
-        auto write   = inject.bytes();
+        int offset;
         switch (pouch)
         {
             case Pouch::NormalItem:
-                std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
+                offset = PouchHeldItem;
                 break;
             case Pouch::KeyItem:
-                std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
+                offset = PouchKeyItem;
                 break;
             case Pouch::TM:
-                std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
+                offset = PouchTMHM;
                 break;
             case Pouch::Medicine:
-                std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
+                offset = PouchMedicine;
                 break;
             case Pouch::Berry:
-                std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
+                offset = PouchBerry;
                 break;
             case Pouch::ZCrystals:
-                std::copy(write.begin(), write.end(), &data[PouchZCrystals + slot * 4]);
+                offset = PouchZCrystals;
                 break;
             case Pouch::RotomPower:
-                std::copy(write.begin(), write.end(), &data[BattleItems + slot * 4]);
+                offset = BattleItems;
                 break;
             default:
                 return;
         }
+        Item7 inject = static_cast<Item7>(item);
+        auto write   = inject.bytes();
+        std::copy(write.begin(), write.end(), &data[offset + slot * 4]);
+        markDirty(offset + slot * 4, write.size());
     }
 
     std::unique_ptr<Item> Sav7::item(Pouch pouch, u16 slot) const
@@ -34,19 +34,35 @@ namespace pksm
     {
         pksm::crypto::swsh::applyXor(dt, length);
         blocks = pksm::crypto::swsh::getBlockList(dt, length);
+        decrypted.resize(blocks.size(), nullptr);
     }
 
-    std::shared_ptr<pksm::crypto::swsh::SCBlock> Sav8::getBlock(u32 key) const
+    pksm::crypto::swsh::SCBlock* Sav8::getBlock(u32 key) const
     {
         // binary search
         auto found = std::lower_bound(blocks.begin(), blocks.end(), key,
-            [](const std::shared_ptr<pksm::crypto::swsh::SCBlock>& block, u32 key)
-            { return block->key() < key; });
-        if ((*found)->key() != key)
+            [](const pksm::crypto::swsh::SCBlock& block, u32 key) { return block.key() < key; });
+        if (found == blocks.end() || found->key() != key)
         {
             return nullptr;
         }
-        return *found;
+        return &*found;
+    }
+
+    Sav8::BlockHandle Sav8::requireBlock(u32 key)
+    {
+        if (auto block = getBlock(key))
+        {
+            return block - blocks.data();
+        }
+        missingBlocks++;
+        return blocks.size();
+    }
+
+    Sav8::BlockHandle Sav8::optionalBlock(u32 key) const
+    {
+        auto block = getBlock(key);
+        return block ? block - blocks.data() : blocks.size();
     }
 
     std::unique_ptr<PKX> Sav8::emptyPkm() const
@@ -91,13 +107,14 @@ namespace pksm
     {
         if (!encrypted)
         {
+            // Untouched blocks were never decrypted, so this is a nop for them
             for (auto& block : blocks)
             {
-                block->encrypt();
+                block.encrypt();
             }
+            std::ranges::fill(decrypted, nullptr);
 
-            pksm::crypto::swsh::applyXor(data, length);
-            pksm::crypto::swsh::sign(data, length);
+            pksm::crypto::swsh::applyXorAndSign(data, length);
         }
         encrypted = true;
     }
@@ -110,7 +127,6 @@ namespace pksm
         }
         encrypted = false;
 
-        // I could decrypt every block here, but why not just let them be done on the fly via the
-        // functions that need them?
+        // Blocks are decrypted on the fly by the functions that need them
     }
 }
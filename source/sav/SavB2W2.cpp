@@ -54,14 +54,20 @@ namespace pksm
 
     void SavB2W2::resign(void)
     {
-        const u8 blockCount = 74;
+        static constexpr u8 blockCount = 74;
 
-        for (u8 i = 0; i < blockCount; i++)
+        const auto checksum = [this](size_t i)
         {
             u16 cs = pksm::crypto::ccitt16({&data[blockOfs[i]], lengths[i]});
             LittleEndian::convertFrom<u16>(&data[chkMirror[i]], cs);
             LittleEndian::convertFrom<u16>(&data[chkofs[i]], cs);
+        };
+        // The last block holds the copies written to chkMirror, so it has to go after the rest
+        if (dirtyBlocks.resign(checksum, 0, blockCount - 1))
+        {
+            dirtyBlocks.markBlock(blockCount - 1);
         }
+        dirtyBlocks.resign(checksum, blockCount - 1);
 
         // Memories
         // Note: Block 1 and its mirror are encrypted with pokecrypto. The commented lines show how
@@ -54,14 +54,20 @@ namespace pksm
 
     void SavBW::resign(void)
     {
-        const u8 blockCount = 70;
+        static constexpr u8 blockCount = 70;
 
-        for (u8 i = 0; i < blockCount; i++)
+        const auto checksum = [this](size_t i)
         {
             u16 cs = pksm::crypto::ccitt16({&data[blockOfs[i]], lengths[i]});
             LittleEndian::convertFrom<u16>(&data[chkMirror[i]], cs);
             LittleEndian::convertFrom<u16>(&data[chkofs[i]], cs);
+        };
+        // The last block holds the copies written to chkMirror, so it has to go after the rest
+        if (dirtyBlocks.resign(checksum, 0, blockCount - 1))
+        {
+            dirtyBlocks.markBlock(blockCount - 1);
         }
+        dirtyBlocks.resign(checksum, blockCount - 1);
     }
 
     SmallVector<std::pair<Sav::Pouch, std::span<const int>>, 15> SavBW::validItems() const
@@ -68,6 +68,7 @@ namespace pksm
     void SavLGPE::partyBoxSlot(u8 slot, u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[0x5A00 + slot * 2], v);
+        markDirty(0x5A00 + slot * 2, 2);
     }
 
     u32 SavLGPE::partyOffset(u8 slot) const
@@ -88,6 +89,7 @@ namespace pksm
     void SavLGPE::boxedPkm(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[0x5A00 + 14], v);
+        markDirty(0x5A00 + 14, 2);
     }
 
     u16 SavLGPE::followPkm() const
@@ -98,6 +100,7 @@ namespace pksm
     void SavLGPE::followPkm(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[0x5A00 + 12], v);
+        markDirty(0x5A00 + 12, 2);
     }
 
     u8 SavLGPE::partyCount() const
@@ -149,6 +152,8 @@ namespace pksm
                         &data[emptyOffset], &data[emptyOffset + PB7::PARTY_LENGTH], emptyData);
                     std::copy(&data[offset], &data[offset + PB7::PARTY_LENGTH], &data[emptyOffset]);
                     std::copy(emptyData, emptyData + PB7::PARTY_LENGTH, &data[offset]);
+                    markDirty(emptyOffset, PB7::PARTY_LENGTH);
+                    markDirty(offset, PB7::PARTY_LENGTH);
                     for (int j = 0; j < partyCount(); j++)
                     {
                         if (partyBoxSlot(j) == i)
@@ -166,16 +171,27 @@ namespace pksm
         }
     }
 
-    void SavLGPE::resign()
+    void SavLGPE::fixBoxes()
     {
-        const u8 blockCount = 21;
-        const u32 csoff     = 0xB861A;
-
-        for (u8 i = 0; i < blockCount; i++)
+        compressBox();
+        u16 count = 0;
+        while (count < maxSlot() && isPKM(&data[boxOffset(count / 30, count % 30)]))
         {
-            LittleEndian::convertFrom<u16>(
-                &data[csoff + i * 8], pksm::crypto::crc16_noinvert({&data[chkofs[i]], chklen[i]}));
+            count++;
         }
+        boxedPkm(count);
+    }
+
+    void SavLGPE::resign()
+    {
+        static constexpr u32 csoff = 0xB861A;
+
+        dirtyBlocks.resign(
+            [this](size_t i)
+            {
+                LittleEndian::convertFrom<u16>(&data[csoff + i * 8],
+                    pksm::crypto::crc16_noinvert({&data[chkofs[i]], chklen[i]}));
+            });
     }
 
     u16 SavLGPE::TID() const
@@ -186,6 +202,7 @@ namespace pksm
     void SavLGPE::TID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[0x1000], v);
+        markDirty(0x1000, 2);
     }
 
     u16 SavLGPE::SID() const
@@ -196,6 +213,7 @@ namespace pksm
     void SavLGPE::SID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[0x1002], v);
+        markDirty(0x1002, 2);
     }
 
     GameVersion SavLGPE::version() const
@@ -206,6 +224,7 @@ namespace pksm
     void SavLGPE::version(GameVersion v)
     {
         data[0x1004] = u8(v);
+        markDirty(0x1004);
     }
 
     Gender SavLGPE::gender() const
@@ -216,6 +235,7 @@ namespace pksm
     void SavLGPE::gender(Gender v)
     {
         data[0x1005] = u8(v);
+        markDirty(0x1005);
     }
 
     Language SavLGPE::language() const
@@ -226,6 +246,7 @@ namespace pksm
     void SavLGPE::language(Language v)
     {
         data[0x1035] = u8(v);
+        markDirty(0x1035);
     }
 
     std::string SavLGPE::otName() const
@@ -233,9 +254,15 @@ namespace pksm
         return StringUtils::getString(data.get(), 0x1000 + 0x38, 13);
     }
 
+    size_t SavLGPE::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString(data.get(), 0x1000 + 0x38, 13, {out, size});
+    }
+
     void SavLGPE::otName(const std::string_view& v)
     {
         StringUtils::setString(data.get(), v, 0x1000 + 0x38, 13);
+        markDirty(0x1000 + 0x38, 13 * 2);
     }
 
     u32 SavLGPE::money() const
@@ -246,6 +273,7 @@ namespace pksm
     void SavLGPE::money(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[0x4C04], v);
+        markDirty(0x4C04, 4);
     }
 
     u8 SavLGPE::badges() const
@@ -275,6 +303,7 @@ namespace pksm
     void SavLGPE::playedHours(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[0x45400], v);
+        markDirty(0x45400, 2);
     }
 
     u8 SavLGPE::playedMinutes(void) const
@@ -285,6 +314,7 @@ namespace pksm
     void SavLGPE::playedMinutes(u8 v)
     {
         data[0x45402] = v;
+        markDirty(0x45402);
     }
 
     u8 SavLGPE::playedSeconds(void) const
@@ -295,6 +325,7 @@ namespace pksm
     void SavLGPE::playedSeconds(u8 v)
     {
         data[0x45403] = v;
+        markDirty(0x45403);
     }
 
     std::unique_ptr<PKX> SavLGPE::pkm(u8 slot) const
@@ -310,6 +341,17 @@ namespace pksm
         }
     }
 
+    u8* SavLGPE::boxSlotData(u8 box, u8 slot) const
+    {
+        return &data[boxOffset(box, slot)];
+    }
+
+    u8* SavLGPE::partySlotData(u8 slot) const
+    {
+        u32 off = partyOffset(slot);
+        return off != 0 ? &data[off] : nullptr;
+    }
+
     std::unique_ptr<PKX> SavLGPE::pkm(u8 box, u8 slot) const
     {
         return PKX::getPKM<Generation::LGPE>(&data[boxOffset(box, slot)], PB7::PARTY_LENGTH);
@@ -327,6 +369,7 @@ namespace pksm
 
             std::ranges::copy(
                 pb7->rawData().subspan(0, PB7::PARTY_LENGTH), &data[boxOffset(box, slot)]);
+            markDirty(boxOffset(box, slot), PB7::PARTY_LENGTH);
         }
     }
 
@@ -341,6 +384,7 @@ namespace pksm
                 if (off != 0)
                 {
                     std::fill_n(&data[off], PB7::PARTY_LENGTH, 0);
+                    markDirty(off, PB7::PARTY_LENGTH);
                 }
                 partyBoxSlot(slot, 1001);
                 return;
@@ -364,6 +408,7 @@ namespace pksm
 
             auto pb7 = pk.partyClone();
             std::ranges::copy(pb7->rawData().subspan(0, PB7::PARTY_LENGTH), &data[off]);
+            markDirty(off, PB7::PARTY_LENGTH);
             partyBoxSlot(slot, newSlot);
         }
     }
@@ -405,34 +450,12 @@ namespace pksm
 
     int SavLGPE::dexFormCount(int species) const
     {
-        for (int i = 0; i < 62; i += 2)
-        {
-            if (formtable[i] == species)
-            {
-                return formtable[i + 1];
-            }
-            else if (formtable[i] > species)
-            {
-                return 0;
-            }
-        }
-        return 0;
+        return dexForms.count(species);
     }
 
     int SavLGPE::dexFormIndex(int species, int formct, int start) const
     {
-        int formindex = start;
-        int f         = 0;
-        for (int i = 0; i < 62; i += 2)
-        {
-            if (formtable[i] == species)
-            {
-                break;
-            }
-            f         = formtable[i + 1];
-            formindex += f - 1;
-        }
-        return f > formct ? -1 : formindex;
+        return dexForms.index(species, formct, start);
     }
 
     bool SavLGPE::sanitizeFormsToIterate(Species species, int& fs, int& fe, int formIn) const
@@ -463,6 +486,7 @@ namespace pksm
 
         int brSeen              = shift * brSize;
         data[off + brSeen + bd] |= (u8)(1 << bm);
+        markDirty(off + brSeen + bd);
 
         bool displayed = false;
         for (u8 i = 0; i < 4; i++)
@@ -485,6 +509,7 @@ namespace pksm
         }
 
         data[off + (4 + shift) * brSize + bd] |= (1 << bm);
+        markDirty(off + (4 + shift) * brSize + bd);
     }
 
     int SavLGPE::getDexFlags(int index, int baseSpecies) const
@@ -512,14 +537,14 @@ namespace pksm
         return ret;
     }
 
-    void SavLGPE::dex(const PKX& pk)
+    void SavLGPE::writeDex(const PKX& pk)
     {
         int n                    = u16(pk.species());
         int MaxSpeciesID         = 809;
         int PokeDex              = 0x2A00;
         int PokeDexLanguageFlags = PokeDex + 0x550;
 
-        if (!(availableSpecies().count(pk.species()) > 0) || pk.egg())
+        if (!isAvailable(pk.species()) || pk.egg())
         {
             return;
         }
@@ -541,16 +566,20 @@ namespace pksm
             { // Already 2
                 LittleEndian::convertFrom<u32>(
                     &data[PokeDex + 0x8E8 + shift * 4], pk.encryptionConstant());
+                markDirty(PokeDex + 0x8E8 + shift * 4, 4);
                 data[PokeDex + 0x84] |= (u8)(1 << shift);
+                markDirty(PokeDex + 0x84);
             }
             else if ((data[PokeDex + 0x84] & (1 << shift)) == 0)
             {                                             // Not yet 1
                 data[PokeDex + 0x84] |= (u8)(1 << shift); // 1
+                markDirty(PokeDex + 0x84);
             }
         }
 
         int off        = PokeDex + 0x08 + 0x80;
         data[off + bd] |= (1 << bm);
+        markDirty(off + bd);
 
         int formstart = pk.alternativeForm();
         int formend   = formstart;
@@ -597,69 +626,46 @@ namespace pksm
             if (lbit >> 3 < 920)
             {
                 data[PokeDexLanguageFlags + (lbit >> 3)] |= (u8)(1 << (lbit & 7));
+                markDirty(PokeDexLanguageFlags + (lbit >> 3));
             }
         }
     }
 
-    int SavLGPE::dexSeen(void) const
+    bool SavLGPE::speciesSeen(Species species) const
     {
-        int ret = 0;
-        for (const auto& species : availableSpecies())
+        // The base form is always checked, even where the personal data says there are no forms
+        int forms = std::max(int(formCount(species)), 1);
+        for (int form = 0; form < forms; form++)
         {
-            int forms = formCount(species);
-            for (int form = 0; form < forms; form++)
-            {
-                int dexForms = form == 0 ? -1
-                                         : dexFormIndex(u16(species), forms,
-                                               u16(VersionTables::maxSpecies(version())) - 1);
+            int dexForms = form == 0 ? -1
+                                     : dexFormIndex(u16(species), forms,
+                                           u16(VersionTables::maxSpecies(version())) - 1);
 
-                int index = u16(species) - 1;
-                if (dexForms >= 0)
-                {
-                    index = dexForms + form;
-                }
+            int index = u16(species) - 1;
+            if (dexForms >= 0)
+            {
+                index = dexForms + form;
+            }
 
-                if (getDexFlags(index, u16(species)) > 0)
-                {
-                    ret++;
-                    break;
-                }
+            if (getDexFlags(index, u16(species) - 1) > 0)
+            {
+                return true;
             }
         }
-        return ret;
+        return false;
     }
 
-    int SavLGPE::dexCaught(void) const
+    bool SavLGPE::speciesCaught(Species species) const
     {
-        int ret = 0;
-        for (const auto& species : availableSpecies())
-        {
-            if (data[PokeDex + 0x88 + (u16(species) - 1) / 8] & (1 << ((u16(species) - 1) % 8)))
-            {
-                ret++;
-            }
-        }
-        return ret;
+        int bit = u16(species) - 1;
+        return (data[PokeDex + 0x88 + (bit >> 3)] >> (bit & 7) & 1) != 0;
     }
 
     void SavLGPE::cryptBoxData(bool crypted)
     {
-        for (u8 box = 0; box < maxBoxes(); box++)
-        {
-            for (u8 slot = 0; slot < 30; slot++)
-            {
-                if (box * 30 + slot > 1000)
-                {
-                    return;
-                }
-                std::unique_ptr<PKX> pb7 = PKX::getPKM<Generation::LGPE>(
-                    &data[boxOffset(box, slot)], PB7::PARTY_LENGTH, true);
-                if (!crypted)
-                {
-                    pb7->encrypt();
-                }
-            }
-        }
+        // Storage is one flat list of party-sized slots, which ends after slot 1000
+        PB7::cryptBoxData(&data[boxOffset(0, 0)], std::min(maxBoxes() * 30, 1001), true, crypted);
+        markDirty(boxOffset(0, 0), std::min(maxBoxes() * 30, 1001) * PB7::PARTY_LENGTH);
     }
 
     void SavLGPE::mysteryGift(const WCX& wc, int&)
@@ -901,36 +907,42 @@ namespace pksm
                 if (slot < 60)
                 {
                     std::copy(write.begin(), write.end(), &data[slot * 4]);
+                    markDirty(slot * 4, 4);
                 }
                 break;
             case Pouch::TM:
                 if (slot < 108)
                 {
                     std::copy(write.begin(), write.end(), &data[0xF0 + slot * 4]);
+                    markDirty(0xF0 + slot * 4, 4);
                 }
                 break;
             case Pouch::Candy:
                 if (slot < 200)
                 {
                     std::copy(write.begin(), write.end(), &data[0x2A0 + slot * 4]);
+                    markDirty(0x2A0 + slot * 4, 4);
                 }
                 break;
             case Pouch::ZCrystals:
                 if (slot < 150)
                 {
                     std::copy(write.begin(), write.end(), &data[0x5C0 + slot * 4]);
+                    markDirty(0x5C0 + slot * 4, 4);
                 }
                 break;
             case Pouch::CatchingItem:
                 if (slot < 50)
                 {
                     std::copy(write.begin(), write.end(), &data[0x818 + slot * 4]);
+                    markDirty(0x818 + slot * 4, 4);
                 }
                 break;
             case Pouch::Battle:
                 if (slot < 150)
                 {
                     std::copy(write.begin(), write.end(), &data[0x8E0 + slot * 4]);
+                    markDirty(0x8E0 + slot * 4, 4);
                 }
                 break;
             case Pouch::KeyItem:
@@ -938,6 +950,7 @@ namespace pksm
                 if (slot < 150)
                 {
                     std::copy(write.begin(), write.end(), &data[0xB38 + slot * 4]);
+                    markDirty(0xB38 + slot * 4, 4);
                 }
                 break;
             default:
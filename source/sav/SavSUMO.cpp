@@ -57,18 +57,23 @@ namespace pksm
 
     void SavSUMO::resign(void)
     {
-        static constexpr u8 blockCount = 37;
-        static constexpr u32 csoff     = 0x6BC1A;
+        static constexpr u32 csoff = 0x6BC1A;
 
-        for (u8 i = 0; i < blockCount; i++)
-        {
-            // Clear memecrypto data
-            if (LittleEndian::convertTo<u16>(&data[csoff + i * 8 - 2]) == 36)
+        const bool changed = dirtyBlocks.resign(
+            [this](size_t i)
             {
-                std::fill_n(&data[chkofs[i] + 0x100], 0x80, 0);
-            }
-            LittleEndian::convertFrom<u16>(
-                &data[csoff + i * 8], pksm::crypto::crc16({&data[chkofs[i]], chklen[i]}));
+                // Clear memecrypto data
+                if (LittleEndian::convertTo<u16>(&data[csoff + i * 8 - 2]) == 36)
+                {
+                    std::fill_n(&data[chkofs[i] + 0x100], 0x80, 0);
+                }
+                LittleEndian::convertFrom<u16>(
+                    &data[csoff + i * 8], pksm::crypto::crc16({&data[chkofs[i]], chklen[i]}));
+            });
+        // The signature only covers the checksum table
+        if (!changed)
+        {
+            return;
         }
 
         static constexpr u32 checksumTableOffset = 0x6BC00;
@@ -86,30 +91,12 @@ namespace pksm
 
     int SavSUMO::dexFormIndex(int species, int formct, int start) const
     {
-        int formindex = start;
-        int f         = 0;
-        for (u8 i = 0; i < 230; i += 2)
-        {
-            if (formtable[i] == species)
-            {
-                break;
-            }
-            f         = formtable[i + 1];
-            formindex += f - 1;
-        }
-        return f > formct ? -1 : formindex;
+        return dexForms.index(species, formct, start);
     }
 
     int SavSUMO::dexFormCount(int species) const
     {
-        for (u8 i = 0; i < 230; i += 2)
-        {
-            if (formtable[i] == species)
-            {
-                return formtable[i + 1];
-            }
-        }
-        return 0;
+        return dexForms.count(species);
     }
 
     SmallVector<std::pair<Sav::Pouch, std::span<const int>>, 15> SavSUMO::validItems() const
@@ -186,149 +186,157 @@ namespace pksm
     {
         game = Game::SWSH;
 
-        Box            = 0x0d66012c;
-        WondercardData = 0x112d5141;
-        Party          = 0x2985fe5d;
-        PokeDex        = 0x4716c404;
-        ArmorDex       = 0x3F936BA9;
-        CrownDex       = 0x3C9366F0;
-        Items          = 0x1177c2c4;
-        BoxLayout      = 0x19722c89;
-        Misc           = 0x1b882b09;
-        TrainerCard    = 0x874da6fa;
-        PlayTime       = 0x8cbbfd90;
-        Status         = 0xf25c070e;
+        boxBlock         = requireBlock(BOX_KEY);
+        partyBlock       = requireBlock(PARTY_KEY);
+        dexBlock         = requireBlock(POKEDEX_KEY);
+        itemBlock        = requireBlock(ITEMS_KEY);
+        boxLayoutBlock   = requireBlock(BOXLAYOUT_KEY);
+        miscBlock        = requireBlock(MISC_KEY);
+        trainerCardBlock = requireBlock(TRAINERCARD_KEY);
+        playTimeBlock    = requireBlock(PLAYTIME_KEY);
+        statusBlock      = requireBlock(STATUS_KEY);
+        currentBoxBlock  = requireBlock(CURRENTBOX_KEY);
+        wallpaperBlock   = requireBlock(WALLPAPER_KEY);
+
+        // Only there once the save has been updated for the respective DLC
+        armorDexBlock = optionalBlock(ARMORDEX_KEY);
+        crownDexBlock = optionalBlock(CROWNDEX_KEY);
     }
 
     u16 SavSWSH::TID(void) const
     {
-        return LittleEndian::convertTo<u16>(getBlock(Status)->decryptedData() + 0xA0);
+        return LittleEndian::convertTo<u16>(blockData(statusBlock) + 0xA0);
     }
 
     void SavSWSH::TID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(getBlock(Status)->decryptedData() + 0xA0, v);
-        LittleEndian::convertFrom<u32>(getBlock(TrainerCard)->decryptedData() + 0x1C, displayTID());
+        LittleEndian::convertFrom<u16>(blockData(statusBlock) + 0xA0, v);
+        LittleEndian::convertFrom<u32>(blockData(trainerCardBlock) + 0x1C, displayTID());
     }
 
     u16 SavSWSH::SID(void) const
     {
-        return LittleEndian::convertTo<u16>(getBlock(Status)->decryptedData() + 0xA2);
+        return LittleEndian::convertTo<u16>(blockData(statusBlock) + 0xA2);
     }
 
     void SavSWSH::SID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(getBlock(Status)->decryptedData() + 0xA2, v);
-        LittleEndian::convertFrom<u32>(getBlock(TrainerCard)->decryptedData() + 0x1C, displayTID());
+        LittleEndian::convertFrom<u16>(blockData(statusBlock) + 0xA2, v);
+        LittleEndian::convertFrom<u32>(blockData(trainerCardBlock) + 0x1C, displayTID());
     }
 
     GameVersion SavSWSH::version(void) const
     {
-        return GameVersion(getBlock(Status)->decryptedData()[0xA4]);
+        return GameVersion(blockData(statusBlock)[0xA4]);
     }
 
     void SavSWSH::version(GameVersion v)
     {
-        getBlock(Status)->decryptedData()[0xA4] = u8(v);
+        blockData(statusBlock)[0xA4] = u8(v);
     }
 
     Gender SavSWSH::gender(void) const
     {
-        return Gender{getBlock(Status)->decryptedData()[0xA5]};
+        return Gender{blockData(statusBlock)[0xA5]};
     }
 
     void SavSWSH::gender(Gender v)
     {
-        getBlock(Status)->decryptedData()[0xA5] = u8(v);
+        blockData(statusBlock)[0xA5] = u8(v);
     }
 
     Language SavSWSH::language(void) const
     {
-        return Language(getBlock(Status)->decryptedData()[0xA7]);
+        return Language(blockData(statusBlock)[0xA7]);
     }
 
     void SavSWSH::language(Language v)
     {
-        getBlock(Status)->decryptedData()[0xA7] = u8(v);
+        blockData(statusBlock)[0xA7] = u8(v);
     }
 
     std::string SavSWSH::otName(void) const
     {
-        return StringUtils::getString(getBlock(Status)->decryptedData(), 0xB0, 13);
+        return StringUtils::getString(blockData(statusBlock), 0xB0, 13);
+    }
+
+    size_t SavSWSH::otName(char* out, size_t size) const
+    {
+        return StringUtils::getString(blockData(statusBlock), 0xB0, 13, {out, size});
     }
 
     void SavSWSH::otName(const std::string_view& v)
     {
-        StringUtils::setString(getBlock(Status)->decryptedData(), v, 0xB0, 13);
-        StringUtils::setString(getBlock(TrainerCard)->decryptedData(), v, 0, 13);
+        StringUtils::setString(blockData(statusBlock), v, 0xB0, 13);
+        StringUtils::setString(blockData(trainerCardBlock), v, 0, 13);
     }
 
     std::string SavSWSH::jerseyNum(void) const
     {
-        return std::string((char*)getBlock(TrainerCard)->decryptedData() + 0x39, 3);
+        return std::string((char*)blockData(trainerCardBlock) + 0x39, 3);
     }
 
     void SavSWSH::jerseyNum(const std::string_view& v)
     {
         for (size_t i = 0; i < std::min(v.size(), (size_t)3); i++)
         {
-            getBlock(TrainerCard)->decryptedData()[0x39 + i] = v[i];
+            blockData(trainerCardBlock)[0x39 + i] = v[i];
         }
     }
 
     u32 SavSWSH::money(void) const
     {
-        return LittleEndian::convertTo<u32>(getBlock(Misc)->decryptedData());
+        return LittleEndian::convertTo<u32>(blockData(miscBlock));
     }
 
     void SavSWSH::money(u32 v)
     {
-        LittleEndian::convertFrom<u32>(getBlock(Misc)->decryptedData(), v);
+        LittleEndian::convertFrom<u32>(blockData(miscBlock), v);
     }
 
     u32 SavSWSH::BP(void) const
     {
-        return LittleEndian::convertTo<u32>(getBlock(Misc)->decryptedData() + 4);
+        return LittleEndian::convertTo<u32>(blockData(miscBlock) + 4);
     }
 
     void SavSWSH::BP(u32 v)
     {
-        LittleEndian::convertFrom<u32>(getBlock(Misc)->decryptedData() + 4, v);
+        LittleEndian::convertFrom<u32>(blockData(miscBlock) + 4, v);
     }
 
     u8 SavSWSH::badges(void) const
     {
-        return getBlock(Misc)->decryptedData()[0x11C];
+        return blockData(miscBlock)[0x11C];
     }
 
     u16 SavSWSH::playedHours(void) const
     {
-        return LittleEndian::convertTo<u16>(getBlock(PlayTime)->decryptedData());
+        return LittleEndian::convertTo<u16>(blockData(playTimeBlock));
     }
 
     void SavSWSH::playedHours(u16 v)
     {
-        LittleEndian::convertFrom<u16>(getBlock(PlayTime)->decryptedData(), v);
+        LittleEndian::convertFrom<u16>(blockData(playTimeBlock), v);
     }
 
     u8 SavSWSH::playedMinutes(void) const
     {
-        return getBlock(PlayTime)->decryptedData()[2];
+        return blockData(playTimeBlock)[2];
     }
 
     void SavSWSH::playedMinutes(u8 v)
     {
-        getBlock(PlayTime)->decryptedData()[2] = v;
+        blockData(playTimeBlock)[2] = v;
     }
 
     u8 SavSWSH::playedSeconds(void) const
     {
-        return getBlock(PlayTime)->decryptedData()[3];
+        return blockData(playTimeBlock)[3];
     }
 
     void SavSWSH::playedSeconds(u8 v)
     {
-        getBlock(PlayTime)->decryptedData()[3] = v;
+        blockData(playTimeBlock)[3] = v;
     }
 
     void SavSWSH::item(const Item& item, Pouch pouch, u16 slot)
@@ -338,39 +346,31 @@ namespace pksm
         switch (pouch)
         {
             case Pouch::Medicine:
-                std::copy(write.begin(), write.end(), getBlock(Items)->decryptedData() + 4 * slot);
+                std::copy(write.begin(), write.end(), blockData(itemBlock) + 4 * slot);
                 break;
             case Pouch::Ball:
-                std::copy(
-                    write.begin(), write.end(), getBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
+                std::copy(write.begin(), write.end(), blockData(itemBlock) + 0xF0 + 4 * slot);
                 break;
             case Pouch::Battle:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x168 + 4 * slot);
+                std::copy(write.begin(), write.end(), blockData(itemBlock) + 0x168 + 4 * slot);
                 break;
             case Pouch::Berry:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
+                std::copy(write.begin(), write.end(), blockData(itemBlock) + 0x1B8 + 4 * slot);
                 break;
             case Pouch::NormalItem:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
+                std::copy(write.begin(), write.end(), blockData(itemBlock) + 0x2F8 + 4 * slot);
                 break;
             case Pouch::TM:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
+                std::copy(write.begin(), write.end(), blockData(itemBlock) + 0xB90 + 4 * slot);
                 break;
             case Pouch::Treasure:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
+                std::copy(write.begin(), write.end(), blockData(itemBlock) + 0xED8 + 4 * slot);
                 break;
             case Pouch::Ingredient:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
+                std::copy(write.begin(), write.end(), blockData(itemBlock) + 0x1068 + 4 * slot);
                 break;
             case Pouch::KeyItem:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
+                std::copy(write.begin(), write.end(), blockData(itemBlock) + 0x11F8 + 4 * slot);
                 break;
             default:
                 break;
@@ -382,25 +382,23 @@ namespace pksm
         switch (pouch)
         {
             case Pouch::Medicine:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 4 * slot);
+                return std::make_unique<Item8>(blockData(itemBlock) + 4 * slot);
             case Pouch::Ball:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
+                return std::make_unique<Item8>(blockData(itemBlock) + 0xF0 + 4 * slot);
             case Pouch::Battle:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x168 + 4 * slot);
+                return std::make_unique<Item8>(blockData(itemBlock) + 0x168 + 4 * slot);
             case Pouch::Berry:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
+                return std::make_unique<Item8>(blockData(itemBlock) + 0x1B8 + 4 * slot);
             case Pouch::NormalItem:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
+                return std::make_unique<Item8>(blockData(itemBlock) + 0x2F8 + 4 * slot);
             case Pouch::TM:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
+                return std::make_unique<Item8>(blockData(itemBlock) + 0xB90 + 4 * slot);
             case Pouch::Treasure:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
+                return std::make_unique<Item8>(blockData(itemBlock) + 0xED8 + 4 * slot);
             case Pouch::Ingredient:
-                return std::make_unique<Item8>(
-                    getBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
+                return std::make_unique<Item8>(blockData(itemBlock) + 0x1068 + 4 * slot);
             case Pouch::KeyItem:
-                return std::make_unique<Item8>(
-                    getBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
+                return std::make_unique<Item8>(blockData(itemBlock) + 0x11F8 + 4 * slot);
             default:
                 return std::make_unique<Item8>();
         }
@@ -520,32 +518,37 @@ namespace pksm
 
     u8 SavSWSH::currentBox() const
     {
-        return LittleEndian::convertTo<u32>(getBlock(0x017C3CBB)->decryptedData());
+        return LittleEndian::convertTo<u32>(blockData(currentBoxBlock));
     }
 
     void SavSWSH::currentBox(u8 box)
     {
-        LittleEndian::convertFrom<u32>(getBlock(0x017C3CBB)->decryptedData(), box);
+        LittleEndian::convertFrom<u32>(blockData(currentBoxBlock), box);
     }
 
     std::string SavSWSH::boxName(u8 box) const
     {
-        return StringUtils::getString(getBlock(BoxLayout)->decryptedData(), box * 0x22, 17);
+        return StringUtils::getString(blockData(boxLayoutBlock), box * 0x22, 17);
+    }
+
+    size_t SavSWSH::boxName(u8 box, char* out, size_t size) const
+    {
+        return StringUtils::getString(blockData(boxLayoutBlock), box * 0x22, 17, {out, size});
     }
 
     void SavSWSH::boxName(u8 box, const std::string_view& name)
     {
-        StringUtils::setString(getBlock(BoxLayout)->decryptedData(), name, box * 0x22, 17);
+        StringUtils::setString(blockData(boxLayoutBlock), name, box * 0x22, 17);
     }
 
     u8 SavSWSH::boxWallpaper(u8 box) const
     {
-        return LittleEndian::convertTo<u32>(getBlock(0x017C3CBB)->decryptedData() + box * 4);
+        return LittleEndian::convertTo<u32>(blockData(currentBoxBlock) + box * 4);
     }
 
     void SavSWSH::boxWallpaper(u8 box, u8 v)
     {
-        LittleEndian::convertFrom<u32>(getBlock(0x2EB1B190)->decryptedData() + box * 4, v);
+        LittleEndian::convertFrom<u32>(blockData(wallpaperBlock) + box * 4, v);
     }
 
     u32 SavSWSH::boxOffset(u8 box, u8 slot) const
@@ -560,26 +563,34 @@ namespace pksm
 
     u8 SavSWSH::partyCount(void) const
     {
-        return getBlock(Party)->decryptedData()[PK8::PARTY_LENGTH * 6];
+        return blockData(partyBlock)[PK8::PARTY_LENGTH * 6];
     }
 
     void SavSWSH::partyCount(u8 count)
     {
-        getBlock(Party)->decryptedData()[PK8::PARTY_LENGTH * 6] = count;
+        blockData(partyBlock)[PK8::PARTY_LENGTH * 6] = count;
+    }
+
+    u8* SavSWSH::boxSlotData(u8 box, u8 slot) const
+    {
+        return blockData(boxBlock) + boxOffset(box, slot);
+    }
+
+    u8* SavSWSH::partySlotData(u8 slot) const
+    {
+        return blockData(partyBlock) + partyOffset(slot);
     }
 
     std::unique_ptr<PKX> SavSWSH::pkm(u8 slot) const
     {
         u32 offset = partyOffset(slot);
-        return PKX::getPKM<Generation::EIGHT>(
-            getBlock(Party)->decryptedData() + offset, PK8::PARTY_LENGTH);
+        return PKX::getPKM<Generation::EIGHT>(blockData(partyBlock) + offset, PK8::PARTY_LENGTH);
     }
 
     std::unique_ptr<PKX> SavSWSH::pkm(u8 box, u8 slot) const
     {
         u32 offset = boxOffset(box, slot);
-        return PKX::getPKM<Generation::EIGHT>(
-            getBlock(Box)->decryptedData() + offset, PK8::PARTY_LENGTH);
+        return PKX::getPKM<Generation::EIGHT>(blockData(boxBlock) + offset, PK8::PARTY_LENGTH);
     }
 
     void SavSWSH::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
@@ -592,8 +603,7 @@ namespace pksm
                 trade(*pk8);
             }
 
-            std::ranges::copy(
-                pk8->rawData(), getBlock(Box)->decryptedData() + boxOffset(box, slot));
+            std::ranges::copy(pk8->rawData(), blockData(boxBlock) + boxOffset(box, slot));
         }
     }
 
@@ -603,24 +613,13 @@ namespace pksm
         {
             auto pk8 = pk.partyClone();
             pk8->encrypt();
-            std::ranges::copy(pk8->rawData(), getBlock(Party)->decryptedData() + partyOffset(slot));
+            std::ranges::copy(pk8->rawData(), blockData(partyBlock) + partyOffset(slot));
         }
     }
 
     void SavSWSH::cryptBoxData(bool crypted)
     {
-        for (u8 box = 0; box < maxBoxes(); box++)
-        {
-            for (u8 slot = 0; slot < 30; slot++)
-            {
-                std::unique_ptr<PKX> pk8 = PKX::getPKM<Generation::EIGHT>(
-                    getBlock(Box)->decryptedData() + boxOffset(box, slot), PK8::PARTY_LENGTH, true);
-                if (!crypted)
-                {
-                    pk8->encrypt();
-                }
-            }
-        }
+        PK8::cryptBoxData(blockData(boxBlock) + boxOffset(0, 0), maxBoxes() * 30, true, crypted);
     }
 
     void SavSWSH::mysteryGift(const WCX& wc, int&)
@@ -912,24 +911,28 @@ namespace pksm
         return nullptr;
     }
 
-    void SavSWSH::dex(const PKX& pk)
+    u8* SavSWSH::dexEntry(u16 formSpecies) const
     {
-        u8* entryAddr = nullptr;
-        if (!pk.egg())
+        if (u16 index = PersonalSWSH::pokedexIndex(formSpecies))
         {
-            if (u16 index = ((PK8&)pk).pokedexIndex())
-            {
-                entryAddr = getBlock(PokeDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
-            }
-            else if (u16 index = static_cast<const PK8&>(pk).armordexIndex())
-            {
-                entryAddr = getBlock(ArmorDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
-            }
-            else if (u16 index = static_cast<const PK8&>(pk).crowndexIndex())
-            {
-                entryAddr = getBlock(CrownDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
-            }
+            return blockData(dexBlock) + sizeof(DexEntry) * (index - 1);
         }
+        else if (u16 index = PersonalSWSH::armordexIndex(formSpecies);
+                 index && hasBlock(armorDexBlock))
+        {
+            return blockData(armorDexBlock) + sizeof(DexEntry) * (index - 1);
+        }
+        else if (u16 index = PersonalSWSH::crowndexIndex(formSpecies);
+                 index && hasBlock(crownDexBlock))
+        {
+            return blockData(crownDexBlock) + sizeof(DexEntry) * (index - 1);
+        }
+        return nullptr;
+    }
+
+    void SavSWSH::writeDex(const PKX& pk)
+    {
+        u8* entryAddr = pk.egg() ? nullptr : dexEntry(pk.formSpecies());
 
         if (entryAddr)
         {
@@ -962,37 +965,16 @@ namespace pksm
         }
     }
 
-    int SavSWSH::dexSeen() const
+    bool SavSWSH::speciesSeen(Species species) const
     {
-        int ret = 0;
-        for (const auto& i : availableSpecies())
-        {
-            u16 index       = PersonalSWSH::pokedexIndex(u16(i));
-            u8* entryOffset = getBlock(PokeDex)->decryptedData() + index * sizeof(DexEntry);
-            for (size_t j = 0; j < 0x20; j++) // Entire seen region size
-            {
-                if (entryOffset[j])
-                {
-                    ret++;
-                    break;
-                }
-            }
-        }
-        return ret;
+        const u8* entry = dexEntry(u16(species));
+        // Entire seen region
+        return entry && std::any_of(entry, entry + 0x20, [](u8 v) { return v != 0; });
     }
 
-    int SavSWSH::dexCaught() const
+    bool SavSWSH::speciesCaught(Species species) const
     {
-        int ret = 0;
-        for (const auto& i : availableSpecies())
-        {
-            u16 index       = PersonalSWSH::pokedexIndex(u16(i));
-            u8* entryOffset = getBlock(PokeDex)->decryptedData() + index * sizeof(DexEntry);
-            if (entryOffset[0x20] & 3)
-            {
-                ret++;
-            }
-        }
-        return ret;
+        const u8* entry = dexEntry(u16(species));
+        return entry && (entry[0x20] & 3) != 0;
     }
 }
@@ -56,14 +56,14 @@ namespace pksm
 
     void SavXY::resign(void)
     {
-        static constexpr u8 blockCount = 55;
-        static constexpr u32 csoff     = 0x6541A;
+        static constexpr u32 csoff = 0x6541A;
 
-        for (u8 i = 0; i < blockCount; i++)
-        {
-            LittleEndian::convertFrom<u16>(
-                &data[csoff + i * 8], pksm::crypto::ccitt16({&data[chkofs[i]], chklen[i]}));
-        }
+        dirtyBlocks.resign(
+            [this](size_t i)
+            {
+                LittleEndian::convertFrom<u16>(
+                    &data[csoff + i * 8], pksm::crypto::ccitt16({&data[chkofs[i]], chklen[i]}));
+            });
     }
 
     SmallVector<std::pair<Sav::Pouch, std::span<const int>>, 15> SavXY::validItems() const
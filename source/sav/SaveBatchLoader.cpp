@@ -0,0 +1,158 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "sav/SaveBatchLoader.hpp"
+#include "sav/Sav.hpp"
+#include "utils/io.hpp"
+#include <exception>
+
+#ifndef _PKSMCORE_CONFIGURED
+#include "PKSMCORE_CONFIG.h"
+#endif
+
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+#include <thread>
+#endif
+
+namespace
+{
+    pksm::SaveBatchLoader::Result parse(const std::shared_ptr<u8[]>& data, size_t length)
+    {
+        pksm::SaveBatchLoader::Result ret;
+        try
+        {
+            ret.save = pksm::Sav::getSave(data, length);
+            if (!ret.save)
+            {
+                ret.error = pksm::SaveBatchLoader::Error::UNRECOGNIZED;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            ret.error   = pksm::SaveBatchLoader::Error::PARSE_FAILED;
+            ret.message = e.what();
+        }
+        catch (...)
+        {
+            // Anything escaping a worker thread would terminate the whole batch
+            ret.error   = pksm::SaveBatchLoader::Error::PARSE_FAILED;
+            ret.message = "unknown exception";
+        }
+        return ret;
+    }
+
+    pksm::SaveBatchLoader::Result readAndParse(const std::string& path)
+    {
+        size_t size                = 0;
+        std::shared_ptr<u8[]> data = io::read(path, size);
+        if (data)
+        {
+            return parse(data, size);
+        }
+
+        pksm::SaveBatchLoader::Result ret;
+        ret.error   = pksm::SaveBatchLoader::Error::FILE_UNREADABLE;
+        ret.message = path;
+        return ret;
+    }
+}
+
+namespace pksm
+{
+    SaveBatchLoader::SaveBatchLoader(unsigned threads) : threads(threads)
+    {
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+        if (this->threads == 0)
+        {
+            this->threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+#endif
+    }
+
+    template <typename Loader>
+    void SaveBatchLoader::run(size_t count, const Loader& loader) const
+    {
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        for (size_t i = 0; i < count; i++)
+        {
+            loader(i);
+        }
+#else
+        // Saves take wildly different amounts of time to parse, so rather than splitting the
+        // inputs up front, every worker just takes the next one that's left
+        std::atomic<size_t> next = 0;
+        auto work                = [&next, count, &loader]()
+        {
+            for (size_t i = next++; i < count; i = next++)
+            {
+                loader(i);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        const size_t workerCount = std::min<size_t>(threads, count);
+        // The calling thread is one of them
+        for (size_t i = 1; i < workerCount; i++)
+        {
+            try
+            {
+                workers.emplace_back(work);
+            }
+            catch (const std::system_error&)
+            {
+                // Out of threads; the ones that did start will pick up the slack
+                break;
+            }
+        }
+
+        work();
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+#endif
+    }
+
+    std::vector<SaveBatchLoader::Result> SaveBatchLoader::load(
+        const std::vector<std::pair<std::shared_ptr<u8[]>, size_t>>& buffers) const
+    {
+        std::vector<Result> ret(buffers.size());
+        run(buffers.size(),
+            [&ret, &buffers](size_t i) { ret[i] = parse(buffers[i].first, buffers[i].second); });
+        return ret;
+    }
+
+    std::vector<SaveBatchLoader::Result> SaveBatchLoader::load(
+        const std::vector<std::string>& paths) const
+    {
+        std::vector<Result> ret(paths.size());
+        run(paths.size(), [&ret, &paths](size_t i) { ret[i] = readAndParse(paths[i]); });
+        return ret;
+    }
+}
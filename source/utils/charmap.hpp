@@ -0,0 +1,109 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef CHARMAP_HPP
+#define CHARMAP_HPP
+
+#include "utils/coretypes.h"
+#include <algorithm>
+#include <array>
+#include <optional>
+
+namespace pksm::internal
+{
+    // Every text table is a pair of parallel arrays, characters and the values games store them
+    // as. These turn them around at compile time so that neither direction has to search them
+
+    // Characters indexed by value, with 0xFFFF for values that aren't in the table. Values of Size
+    // or more are left out. If a value appears more than once, the first one wins
+    template <size_t Size, typename Char, typename Value, size_t N>
+    consteval std::array<char16_t, Size> charsByValue(
+        const std::array<Char, N>& chars, const std::array<Value, N>& values)
+    {
+        std::array<char16_t, Size> ret{};
+        ret.fill(0xFFFF);
+        for (size_t i = N; i > 0; i--)
+        {
+            if (values[i - 1] < Size)
+            {
+                ret[values[i - 1]] = chars[i - 1];
+            }
+        }
+        return ret;
+    }
+
+    // values[i] is i, for tables where a character's value is just its position
+    template <typename Value, size_t N>
+    consteval std::array<Value, N> charmapIndices(void)
+    {
+        std::array<Value, N> ret{};
+        for (size_t i = 0; i < N; i++)
+        {
+            ret[i] = i;
+        }
+        return ret;
+    }
+
+    // A table's characters sorted, along with their values, for binary searching. If a character
+    // appears more than once, the first one's value wins, just as searching the table would
+    template <typename Char, typename Value, size_t N>
+    class ValuesByChar
+    {
+    public:
+        consteval ValuesByChar(const std::array<Char, N>& chars, const std::array<Value, N>& values)
+        {
+            // Each character packed together with its index, which both keeps the sort cheap
+            // enough to do at compile time and breaks ties by position
+            std::array<u64, N> sorted{};
+            for (size_t i = 0; i < N; i++)
+            {
+                sorted[i] = (u64(chars[i]) << 32) | i;
+            }
+            std::sort(sorted.begin(), sorted.end());
+            for (size_t i = 0; i < N; i++)
+            {
+                this->chars[i]  = Char(sorted[i] >> 32);
+                this->values[i] = values[u32(sorted[i])];
+            }
+        }
+
+        [[nodiscard]] constexpr std::optional<Value> operator[](char32_t codepoint) const
+        {
+            auto found = std::lower_bound(chars.begin(), chars.end(), codepoint);
+            if (found != chars.end() && *found == codepoint)
+            {
+                return values[std::distance(chars.begin(), found)];
+            }
+            return std::nullopt;
+        }
+
+    private:
+        std::array<Char, N> chars{};
+        std::array<Value, N> values{};
+    };
+}
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62, Pk11
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef CPU_FEATURES_HPP
+#define CPU_FEATURES_HPP
+
+#if defined(__x86_64__) || defined(__i386__)
+#define PKSMCORE_X86_SHA
+#include <cpuid.h>
+#endif
+
+namespace pksm::crypto::internal
+{
+#ifdef PKSMCORE_X86_SHA
+    // Whether the SHA extensions, along with the SSSE3 and SSE4.1 instructions their kernels use,
+    // are available at runtime
+    inline bool cpuHasShaExtensions()
+    {
+        static const bool ret = []
+        {
+            unsigned int eax, ebx, ecx, edx;
+            if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_SSSE3) ||
+                !(ecx & bit_SSE4_1))
+            {
+                return false;
+            }
+            if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+            {
+                return false;
+            }
+            return (ebx & bit_SHA) != 0;
+        }();
+        return ret;
+    }
+
+    // Whether AVX2 is available at runtime and the OS saves the YMM registers across context
+    // switches
+    inline bool cpuHasAvx2()
+    {
+        static const bool ret = []
+        {
+            unsigned int eax, ebx, ecx, edx;
+            if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_OSXSAVE) ||
+                !(ecx & bit_AVX))
+            {
+                return false;
+            }
+            unsigned int xcr0Low, xcr0High;
+            __asm__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+            if ((xcr0Low & 0x6) != 0x6)
+            {
+                return false;
+            }
+            if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+            {
+                return false;
+            }
+            return (ebx & bit_AVX2) != 0;
+        }();
+        return ret;
+    }
+#endif
+}
+
+#endif
@@ -56,34 +56,80 @@ namespace pksm::crypto
             0x4C80, 0x8C41, 0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201,
             0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040};
 
-        u16 crc16(std::span<const u8> buf, u16 initial)
+        // Slicing-by-8 tables: entry [n][b] is the effect of byte b followed by n zero bytes, so
+        // that eight bytes can be folded into the checksum with eight independent lookups
+        constexpr auto crc16_slices = []
         {
-            u16 chk = initial;
-            for (u32 i = 0; i < buf.size(); i++)
+            std::array<std::array<u16, 256>, 8> ret{};
+            for (size_t i = 0; i < 256; i++)
             {
-                chk = (crc16_table[(buf[i] ^ chk) & 0xFF] ^ chk >> 8);
+                ret[0][i] = crc16_table[i];
             }
-            return chk;
-        }
-    }
+            for (size_t n = 1; n < 8; n++)
+            {
+                for (size_t i = 0; i < 256; i++)
+                {
+                    ret[n][i] = (ret[n - 1][i] >> 8) ^ ret[0][ret[n - 1][i] & 0xFF];
+                }
+            }
+            return ret;
+        }();
 
-    u16 ccitt16(std::span<const u8> buf)
-    {
-        u16 crc = 0xFFFF;
-        for (u32 i = 0; i < buf.size(); i++)
+        constexpr auto ccitt16_slices = []
         {
-            crc ^= buf[i] << 8;
-            for (u32 j = 0; j < 0x8; j++)
+            std::array<std::array<u16, 256>, 8> ret{};
+            for (size_t i = 0; i < 256; i++)
             {
-                if ((crc & 0x8000) > 0)
+                u16 crc = i << 8;
+                for (size_t j = 0; j < 8; j++)
                 {
-                    crc = (crc << 1) ^ 0x1021;
+                    crc = (crc & 0x8000) ? u16((crc << 1) ^ 0x1021) : u16(crc << 1);
                 }
-                else
+                ret[0][i] = crc;
+            }
+            for (size_t n = 1; n < 8; n++)
+            {
+                for (size_t i = 0; i < 256; i++)
                 {
-                    crc <<= 1;
+                    ret[n][i] = u16(ret[n - 1][i] << 8) ^ ret[0][ret[n - 1][i] >> 8];
                 }
             }
+            return ret;
+        }();
+
+        u16 crc16(std::span<const u8> buf, u16 initial)
+        {
+            const auto& t = crc16_slices;
+            u16 chk       = initial;
+            size_t i      = 0;
+            for (; i + 8 <= buf.size(); i += 8)
+            {
+                chk = t[7][(buf[i] ^ chk) & 0xFF] ^ t[6][(buf[i + 1] ^ (chk >> 8)) & 0xFF] ^
+                      t[5][buf[i + 2]] ^ t[4][buf[i + 3]] ^ t[3][buf[i + 4]] ^ t[2][buf[i + 5]] ^
+                      t[1][buf[i + 6]] ^ t[0][buf[i + 7]];
+            }
+            for (; i < buf.size(); i++)
+            {
+                chk = (t[0][(buf[i] ^ chk) & 0xFF] ^ chk >> 8);
+            }
+            return chk;
+        }
+    }
+
+    u16 ccitt16(std::span<const u8> buf)
+    {
+        const auto& t = internal::ccitt16_slices;
+        u16 crc       = 0xFFFF;
+        size_t i      = 0;
+        for (; i + 8 <= buf.size(); i += 8)
+        {
+            crc = t[7][buf[i] ^ (crc >> 8)] ^ t[6][buf[i + 1] ^ (crc & 0xFF)] ^ t[5][buf[i + 2]] ^
+                  t[4][buf[i + 3]] ^ t[3][buf[i + 4]] ^ t[2][buf[i + 5]] ^ t[1][buf[i + 6]] ^
+                  t[0][buf[i + 7]];
+        }
+        for (; i < buf.size(); i++)
+        {
+            crc = u16(crc << 8) ^ t[0][buf[i] ^ (crc >> 8)];
         }
         return crc;
     }
@@ -24,85 +24,295 @@
  *         reasonable ways as different from the original version.
  */
 
+#include "cpuFeatures.hpp"
+#include "multiBuffer.hpp"
 #include "utils/crypto.hpp"
+#include <algorithm>
+#include <bit>
+
+#ifdef PKSMCORE_X86_SHA
+#include <immintrin.h>
+#endif
 
 namespace pksm::crypto
 {
-    std::array<u8, 20> sha1(std::span<const u8> data)
-    {
-        SHA1 context;
-        context.update(data);
-        return context.finish();
-    }
-
-    void SHA1::update()
+    namespace
     {
-        u32 w[80];
-        for (size_t i = 0; i < 16; i++)
+        void transformPortable(std::array<u32, 5>& state, const u8* blocks, size_t count)
         {
-            w[i] = (data[i * 4 + 0] << 24) | (data[i * 4 + 1] << 16) | (data[i * 4 + 2] << 8) |
-                   (data[i * 4 + 3] << 0);
-        }
-        for (size_t i = 16; i < 80; i++)
-        {
-            w[i] = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
-            w[i] = std::rotl(w[i], 1);
-        }
+            for (const u8* block = blocks; block != blocks + count * 64; block += 64)
+            {
+                u32 w[80];
+                for (size_t i = 0; i < 16; i++)
+                {
+                    w[i] = (block[i * 4 + 0] << 24) | (block[i * 4 + 1] << 16) |
+                           (block[i * 4 + 2] << 8) | (block[i * 4 + 3] << 0);
+                }
+                for (size_t i = 16; i < 80; i++)
+                {
+                    w[i] = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
+                    w[i] = std::rotl(w[i], 1);
+                }
+
+                u32 a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+
+                for (size_t i = 0; i < 80; i++)
+                {
+                    u32 f, k;
+
+                    if (i < 20)
+                    {
+                        f = (b & c) | ((~b) & d);
+                        k = 0x5A827999;
+                    }
+                    else if (i < 40)
+                    {
+                        f = b ^ c ^ d;
+                        k = 0x6ED9EBA1;
+                    }
+                    else if (i < 60)
+                    {
+                        f = (b & c) | (b & d) | (c & d);
+                        k = 0x8F1BBCDC;
+                    }
+                    else
+                    {
+                        f = b ^ c ^ d;
+                        k = 0xCA62C1D6;
+                    }
+
+                    u32 temp = std::rotl(a, 5) + f + e + k + w[i];
+                    e        = d;
+                    d        = c;
+                    c        = std::rotl(b, 30);
+                    b        = a;
+                    a        = temp;
+                }
 
-        u32 a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+                state[0] += a;
+                state[1] += b;
+                state[2] += c;
+                state[3] += d;
+                state[4] += e;
+            }
+        }
 
-        for (size_t i = 0; i < 80; i++)
+#ifdef PKSMCORE_X86_SHA
+        // Does the four rounds using message group i, expanding the schedule into msg[i % 4] first
+        // if necessary. The round function is an immediate operand, hence the template parameter
+        template <int Function>
+        __attribute__((target("sha,ssse3,sse4.1"))) inline void roundsShaNi(size_t i,
+            const u8* block, __m128i (&msg)[4], __m128i& abcd, __m128i& e, __m128i& lastAbcd)
         {
-            u32 f, k;
+            const __m128i byteSwap = _mm_set_epi64x(0x0001020304050607ULL, 0x08090A0B0C0D0E0FULL);
+
+            if (i < 4)
+            {
+                msg[i] =
+                    _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(block + i * 16)), byteSwap);
+            }
+            else
+            {
+                __m128i expanded = _mm_xor_si128(
+                    _mm_sha1msg1_epu32(msg[i % 4], msg[(i + 1) % 4]), msg[(i + 2) % 4]);
+                msg[i % 4] = _mm_sha1msg2_epu32(expanded, msg[(i + 3) % 4]);
+            }
 
-            if (i < 20)
+            if (i == 0)
+            {
+                e = _mm_add_epi32(e, msg[0]);
+            }
+            else
             {
-                f = (b & c) | ((~b) & d);
-                k = 0x5A827999;
+                e = _mm_sha1nexte_epu32(lastAbcd, msg[i % 4]);
             }
-            else if (i < 40)
+            lastAbcd = abcd;
+            abcd     = _mm_sha1rnds4_epu32(abcd, e, Function);
+        }
+
+        __attribute__((target("sha,ssse3,sse4.1"))) void transformShaNi(
+            std::array<u32, 5>& state, const u8* blocks, size_t count)
+        {
+            __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state[0]), 0x1B);
+            __m128i e0   = _mm_set_epi32(state[4], 0, 0, 0);
+
+            for (const u8* block = blocks; block != blocks + count * 64; block += 64)
             {
-                f = b ^ c ^ d;
-                k = 0x6ED9EBA1;
+                const __m128i abcdSave = abcd;
+                __m128i msg[4];
+                __m128i e = e0, lastAbcd = abcd;
+
+                size_t i = 0;
+                for (; i < 5; i++)
+                {
+                    roundsShaNi<0>(i, block, msg, abcd, e, lastAbcd);
+                }
+                for (; i < 10; i++)
+                {
+                    roundsShaNi<1>(i, block, msg, abcd, e, lastAbcd);
+                }
+                for (; i < 15; i++)
+                {
+                    roundsShaNi<2>(i, block, msg, abcd, e, lastAbcd);
+                }
+                for (; i < 20; i++)
+                {
+                    roundsShaNi<3>(i, block, msg, abcd, e, lastAbcd);
+                }
+
+                e0   = _mm_sha1nexte_epu32(lastAbcd, e0);
+                abcd = _mm_add_epi32(abcd, abcdSave);
             }
-            else if (i < 60)
+
+            _mm_storeu_si128((__m128i*)&state[0], _mm_shuffle_epi32(abcd, 0x1B));
+            state[4] = _mm_extract_epi32(e0, 3);
+        }
+
+        // Hashes one block for each of eight independent messages, one message per 32-bit lane
+        __attribute__((target("avx2"))) void transformAvx2(internal::MultiBufferState<5>& state,
+            const std::array<const u8*, internal::MultiBufferLanes>& blocks)
+        {
+            using internal::rotlAvx2;
+
+            __m256i w[16];
+            internal::loadBlocksAvx2(blocks, w);
+
+            __m256i a = _mm256_loadu_si256((const __m256i*)state[0].data());
+            __m256i b = _mm256_loadu_si256((const __m256i*)state[1].data());
+            __m256i c = _mm256_loadu_si256((const __m256i*)state[2].data());
+            __m256i d = _mm256_loadu_si256((const __m256i*)state[3].data());
+            __m256i e = _mm256_loadu_si256((const __m256i*)state[4].data());
+
+            for (size_t i = 0; i < 80; i++)
             {
-                f = (b & c) | (b & d) | (c & d);
-                k = 0x8F1BBCDC;
+                if (i >= 16)
+                {
+                    w[i % 16] = rotlAvx2<1>(
+                        _mm256_xor_si256(_mm256_xor_si256(w[(i - 3) % 16], w[(i - 8) % 16]),
+                            _mm256_xor_si256(w[(i - 14) % 16], w[i % 16])));
+                }
+
+                __m256i f, k;
+                if (i < 20)
+                {
+                    f = _mm256_or_si256(_mm256_and_si256(b, c), _mm256_andnot_si256(b, d));
+                    k = _mm256_set1_epi32(0x5A827999);
+                }
+                else if (i < 40)
+                {
+                    f = _mm256_xor_si256(_mm256_xor_si256(b, c), d);
+                    k = _mm256_set1_epi32(0x6ED9EBA1);
+                }
+                else if (i < 60)
+                {
+                    f = _mm256_or_si256(
+                        _mm256_and_si256(b, c), _mm256_and_si256(d, _mm256_or_si256(b, c)));
+                    k = _mm256_set1_epi32(0x8F1BBCDC);
+                }
+                else
+                {
+                    f = _mm256_xor_si256(_mm256_xor_si256(b, c), d);
+                    k = _mm256_set1_epi32(0xCA62C1D6);
+                }
+
+                __m256i temp = _mm256_add_epi32(_mm256_add_epi32(rotlAvx2<5>(a), f),
+                    _mm256_add_epi32(_mm256_add_epi32(e, k), w[i % 16]));
+                e            = d;
+                d            = c;
+                c            = rotlAvx2<30>(b);
+                b            = a;
+                a            = temp;
             }
-            else if (i < 80)
+
+            const __m256i results[5] = {a, b, c, d, e};
+            for (size_t word = 0; word < 5; word++)
             {
-                f = b ^ c ^ d;
-                k = 0xCA62C1D6;
+                __m256i* out = (__m256i*)state[word].data();
+                _mm256_storeu_si256(out, _mm256_add_epi32(_mm256_loadu_si256(out), results[word]));
             }
+        }
+#endif
+    }
+
+    std::array<u8, 20> sha1(std::span<const u8> data)
+    {
+        SHA1 context;
+        context.update(data);
+        return context.finish();
+    }
 
-            u32 temp = std::rotl(a, 5) + f + e + k + w[i];
-            e        = d;
-            d        = c;
-            c        = std::rotl(b, 30);
-            b        = a;
-            a        = temp;
+    std::vector<std::array<u8, 20>> sha1Batch(std::span<const std::span<const u8>> buffers)
+    {
+        std::vector<std::array<u8, 20>> ret;
+#ifdef PKSMCORE_X86_SHA
+        // SHA-NI beats eight AVX2 lanes, so only CPUs without it hash the buffers side by side
+        if (buffers.size() > 1 && !internal::cpuHasShaExtensions() && internal::cpuHasAvx2())
+        {
+            ret.resize(buffers.size());
+            internal::hashMultiBuffer<5>(buffers,
+                {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0}, transformAvx2,
+                [&ret](size_t index, const std::array<u32, 5>& state)
+                {
+                    for (size_t word = 0; word < 5; word++)
+                    {
+                        BigEndian::convertFrom<u32>(ret[index].data() + word * 4, state[word]);
+                    }
+                });
+            return ret;
         }
+#endif
+        ret.reserve(buffers.size());
+        SHA1 context;
+        for (const auto& buffer : buffers)
+        {
+            context.reinitialize();
+            context.update(buffer);
+            ret.emplace_back(context.finish());
+        }
+        return ret;
+    }
 
-        state[0] += a;
-        state[1] += b;
-        state[2] += c;
-        state[3] += d;
-        state[4] += e;
+    void SHA1::transform(const u8* blocks, size_t count)
+    {
+#ifdef PKSMCORE_X86_SHA
+        if (internal::cpuHasShaExtensions())
+        {
+            transformShaNi(state, blocks, count);
+            return;
+        }
+#endif
+        transformPortable(state, blocks, count);
     }
 
     void SHA1::update(std::span<const u8> buf)
     {
-        for (size_t i = 0; i < buf.size(); i++)
+        // Top off any partial block left over from a previous call
+        if (dataLength != 0)
         {
-            data[dataLength++] = buf[i];
-            if (dataLength == 64)
+            size_t take = std::min(buf.size(), size_t(64 - dataLength));
+            std::copy(buf.begin(), buf.begin() + take, data + dataLength);
+            dataLength += take;
+            buf        = buf.subspan(take);
+            if (dataLength != 64)
             {
-                update();
-                bitLength  += 512;
-                dataLength = 0;
+                return;
             }
+            transform(data, 1);
+            bitLength  += 512;
+            dataLength = 0;
         }
+
+        // Full blocks are hashed straight from the input without being copied
+        size_t fullBlocks = buf.size() / 64;
+        if (fullBlocks != 0)
+        {
+            transform(buf.data(), fullBlocks);
+            bitLength += 512 * fullBlocks;
+            buf       = buf.subspan(64 * fullBlocks);
+        }
+
+        std::copy(buf.begin(), buf.end(), data);
+        dataLength = buf.size();
     }
 
     std::array<u8, 20> SHA1::finish()
@@ -127,7 +337,7 @@ namespace pksm::crypto
             {
                 data[i++] = 0x00;
             }
-            update();
+            transform(data, 1);
             std::fill_n(data, 56, 0);
         }
 
@@ -141,7 +351,7 @@ namespace pksm::crypto
         data[58]  = bitLength >> 40;
         data[57]  = bitLength >> 48;
         data[56]  = bitLength >> 56;
-        update();
+        transform(data, 1);
 
         // Since this implementation uses little endian byte ordering and SHA uses big endian,
         // reverse all the bytes when copying the final state to the output hash.
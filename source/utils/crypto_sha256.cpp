@@ -24,9 +24,16 @@
  *         reasonable ways as different from the original version.
  */
 
+#include "cpuFeatures.hpp"
+#include "multiBuffer.hpp"
 #include "utils/crypto.hpp"
+#include <algorithm>
 #include <bit>
 
+#ifdef PKSMCORE_X86_SHA
+#include <immintrin.h>
+#endif
+
 #define SHA256_BLOCK_SIZE 32
 
 namespace
@@ -78,6 +85,177 @@ namespace pksm::crypto
             0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
     }
 
+    namespace
+    {
+        void transformPortable(std::array<u32, 8>& state, const u8* blocks, size_t count)
+        {
+            for (const u8* block = blocks; block != blocks + count * 64; block += 64)
+            {
+                uint32_t a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
+
+                for (i = 0, j = 0; i < 16; ++i, j += 4)
+                {
+                    m[i] = (block[j] << 24) | (block[j + 1] << 16) | (block[j + 2] << 8) |
+                           (block[j + 3]);
+                }
+                for (; i < 64; ++i)
+                {
+                    m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+                }
+
+                a = state[0];
+                b = state[1];
+                c = state[2];
+                d = state[3];
+                e = state[4];
+                f = state[5];
+                g = state[6];
+                h = state[7];
+
+                for (i = 0; i < 64; ++i)
+                {
+                    t1 = h + EP1(e) + CH(e, f, g) + internal::sha256_table[i] + m[i];
+                    t2 = EP0(a) + MAJ(a, b, c);
+                    h  = g;
+                    g  = f;
+                    f  = e;
+                    e  = d + t1;
+                    d  = c;
+                    c  = b;
+                    b  = a;
+                    a  = t1 + t2;
+                }
+
+                state[0] += a;
+                state[1] += b;
+                state[2] += c;
+                state[3] += d;
+                state[4] += e;
+                state[5] += f;
+                state[6] += g;
+                state[7] += h;
+            }
+        }
+
+#ifdef PKSMCORE_X86_SHA
+        __attribute__((target("sha,ssse3,sse4.1"))) void transformShaNi(
+            std::array<u32, 8>& state, const u8* blocks, size_t count)
+        {
+            const __m128i byteSwap = _mm_set_epi64x(0x0C0D0E0F08090A0BULL, 0x0405060700010203ULL);
+
+            // The SHA instructions want the state split as ABEF and CDGH
+            __m128i tmp    = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state[0]), 0xB1);
+            __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state[4]), 0x1B);
+            __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+            state1         = _mm_blend_epi16(state1, tmp, 0xF0);
+
+            for (const u8* block = blocks; block != blocks + count * 64; block += 64)
+            {
+                const __m128i abefSave = state0;
+                const __m128i cdghSave = state1;
+
+                // Four rounds at a time, keeping the last four message groups around to expand
+                // the schedule from
+                __m128i msg[4];
+                for (size_t i = 0; i < 16; i++)
+                {
+                    if (i < 4)
+                    {
+                        msg[i] = _mm_shuffle_epi8(
+                            _mm_loadu_si128((const __m128i*)(block + i * 16)), byteSwap);
+                    }
+                    else
+                    {
+                        __m128i expanded = _mm_add_epi32(
+                            _mm_sha256msg1_epu32(msg[i % 4], msg[(i + 1) % 4]),
+                            _mm_alignr_epi8(msg[(i + 3) % 4], msg[(i + 2) % 4], 4));
+                        msg[i % 4] = _mm_sha256msg2_epu32(expanded, msg[(i + 3) % 4]);
+                    }
+
+                    __m128i words = _mm_add_epi32(
+                        msg[i % 4], _mm_loadu_si128((const __m128i*)&internal::sha256_table[i * 4]));
+                    state1 = _mm_sha256rnds2_epu32(state1, state0, words);
+                    state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(words, 0x0E));
+                }
+
+                state0 = _mm_add_epi32(state0, abefSave);
+                state1 = _mm_add_epi32(state1, cdghSave);
+            }
+
+            tmp    = _mm_shuffle_epi32(state0, 0x1B);
+            state1 = _mm_shuffle_epi32(state1, 0xB1);
+            _mm_storeu_si128((__m128i*)&state[0], _mm_blend_epi16(tmp, state1, 0xF0));
+            _mm_storeu_si128((__m128i*)&state[4], _mm_alignr_epi8(state1, tmp, 8));
+        }
+
+        // Hashes one block for each of eight independent messages, one message per 32-bit lane
+        __attribute__((target("avx2"))) void transformAvx2(internal::MultiBufferState<8>& state,
+            const std::array<const u8*, internal::MultiBufferLanes>& blocks)
+        {
+            using internal::rotrAvx2;
+
+            __m256i w[16];
+            internal::loadBlocksAvx2(blocks, w);
+
+            __m256i a = _mm256_loadu_si256((const __m256i*)state[0].data());
+            __m256i b = _mm256_loadu_si256((const __m256i*)state[1].data());
+            __m256i c = _mm256_loadu_si256((const __m256i*)state[2].data());
+            __m256i d = _mm256_loadu_si256((const __m256i*)state[3].data());
+            __m256i e = _mm256_loadu_si256((const __m256i*)state[4].data());
+            __m256i f = _mm256_loadu_si256((const __m256i*)state[5].data());
+            __m256i g = _mm256_loadu_si256((const __m256i*)state[6].data());
+            __m256i h = _mm256_loadu_si256((const __m256i*)state[7].data());
+
+            for (size_t i = 0; i < 64; i++)
+            {
+                if (i >= 16)
+                {
+                    const __m256i w2  = w[(i - 2) % 16];
+                    const __m256i w15 = w[(i - 15) % 16];
+                    const __m256i sig1 = _mm256_xor_si256(
+                        _mm256_xor_si256(rotrAvx2<17>(w2), rotrAvx2<19>(w2)),
+                        _mm256_srli_epi32(w2, 10));
+                    const __m256i sig0 = _mm256_xor_si256(
+                        _mm256_xor_si256(rotrAvx2<7>(w15), rotrAvx2<18>(w15)),
+                        _mm256_srli_epi32(w15, 3));
+                    w[i % 16] = _mm256_add_epi32(_mm256_add_epi32(sig1, w[(i - 7) % 16]),
+                        _mm256_add_epi32(sig0, w[i % 16]));
+                }
+
+                const __m256i ep1 = _mm256_xor_si256(
+                    _mm256_xor_si256(rotrAvx2<6>(e), rotrAvx2<11>(e)), rotrAvx2<25>(e));
+                const __m256i ch =
+                    _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+                const __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, ep1),
+                    _mm256_add_epi32(_mm256_add_epi32(ch, w[i % 16]),
+                        _mm256_set1_epi32(internal::sha256_table[i])));
+
+                const __m256i ep0 = _mm256_xor_si256(
+                    _mm256_xor_si256(rotrAvx2<2>(a), rotrAvx2<13>(a)), rotrAvx2<22>(a));
+                const __m256i maj = _mm256_xor_si256(
+                    _mm256_and_si256(a, _mm256_xor_si256(b, c)), _mm256_and_si256(b, c));
+                const __m256i t2  = _mm256_add_epi32(ep0, maj);
+
+                h = g;
+                g = f;
+                f = e;
+                e = _mm256_add_epi32(d, t1);
+                d = c;
+                c = b;
+                b = a;
+                a = _mm256_add_epi32(t1, t2);
+            }
+
+            const __m256i results[8] = {a, b, c, d, e, f, g, h};
+            for (size_t word = 0; word < 8; word++)
+            {
+                __m256i* out = (__m256i*)state[word].data();
+                _mm256_storeu_si256(out, _mm256_add_epi32(_mm256_loadu_si256(out), results[word]));
+            }
+        }
+#endif
+    }
+
     std::array<u8, 32> sha256(std::span<const u8> buf)
     {
         SHA256 context;
@@ -85,64 +263,80 @@ namespace pksm::crypto
         return context.finish();
     }
 
-    void SHA256::update()
+    std::vector<std::array<u8, 32>> sha256Batch(std::span<const std::span<const u8>> buffers)
     {
-        uint32_t a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
-
-        for (i = 0, j = 0; i < 16; ++i, j += 4)
+        std::vector<std::array<u8, 32>> ret;
+#ifdef PKSMCORE_X86_SHA
+        // SHA-NI beats eight AVX2 lanes, so only CPUs without it hash the buffers side by side
+        if (buffers.size() > 1 && !internal::cpuHasShaExtensions() && internal::cpuHasAvx2())
         {
-            m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
+            ret.resize(buffers.size());
+            internal::hashMultiBuffer<8>(buffers,
+                {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c,
+                    0x1f83d9ab, 0x5be0cd19},
+                transformAvx2,
+                [&ret](size_t index, const std::array<u32, 8>& state)
+                {
+                    for (size_t word = 0; word < 8; word++)
+                    {
+                        BigEndian::convertFrom<u32>(ret[index].data() + word * 4, state[word]);
+                    }
+                });
+            return ret;
         }
-        for (; i < 64; ++i)
+#endif
+        ret.reserve(buffers.size());
+        SHA256 context;
+        for (const auto& buffer : buffers)
         {
-            m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+            context.reinitialize();
+            context.update(buffer);
+            ret.emplace_back(context.finish());
         }
+        return ret;
+    }
 
-        a = state[0];
-        b = state[1];
-        c = state[2];
-        d = state[3];
-        e = state[4];
-        f = state[5];
-        g = state[6];
-        h = state[7];
-
-        for (i = 0; i < 64; ++i)
+    void SHA256::transform(const u8* blocks, size_t count)
+    {
+#ifdef PKSMCORE_X86_SHA
+        if (internal::cpuHasShaExtensions())
         {
-            t1 = h + EP1(e) + CH(e, f, g) + internal::sha256_table[i] + m[i];
-            t2 = EP0(a) + MAJ(a, b, c);
-            h  = g;
-            g  = f;
-            f  = e;
-            e  = d + t1;
-            d  = c;
-            c  = b;
-            b  = a;
-            a  = t1 + t2;
+            transformShaNi(state, blocks, count);
+            return;
         }
-
-        state[0] += a;
-        state[1] += b;
-        state[2] += c;
-        state[3] += d;
-        state[4] += e;
-        state[5] += f;
-        state[6] += g;
-        state[7] += h;
+#endif
+        transformPortable(state, blocks, count);
     }
 
     void SHA256::update(std::span<const u8> buf)
     {
-        for (size_t i = 0; i < buf.size(); i++)
+        // Top off any partial block left over from a previous call
+        if (dataLength != 0)
         {
-            data[dataLength++] = buf[i];
-            if (dataLength == 64)
+            size_t take = std::min(buf.size(), size_t(64 - dataLength));
+            std::copy(buf.begin(), buf.begin() + take, data + dataLength);
+            dataLength += take;
+            buf        = buf.subspan(take);
+            if (dataLength != 64)
             {
-                update();
-                bitLength  += 512;
-                dataLength = 0;
+                return;
             }
+            transform(data, 1);
+            bitLength  += 512;
+            dataLength = 0;
+        }
+
+        // Full blocks are hashed straight from the input without being copied
+        size_t fullBlocks = buf.size() / 64;
+        if (fullBlocks != 0)
+        {
+            transform(buf.data(), fullBlocks);
+            bitLength += 512 * fullBlocks;
+            buf       = buf.subspan(64 * fullBlocks);
         }
+
+        std::copy(buf.begin(), buf.end(), data);
+        dataLength = buf.size();
     }
 
     std::array<u8, 32> SHA256::finish()
@@ -167,7 +361,7 @@ namespace pksm::crypto
             {
                 data[i++] = 0x00;
             }
-            update();
+            transform(data, 1);
             std::fill_n(data, 56, 0);
         }
 
@@ -181,7 +375,7 @@ namespace pksm::crypto
         data[58]  = bitLength >> 40;
         data[57]  = bitLength >> 48;
         data[56]  = bitLength >> 56;
-        update();
+        transform(data, 1);
 
         // Since this implementation uses little endian byte ordering and SHA uses big endian,
         // reverse all the bytes when copying the final state to the output hash.
@@ -26,6 +26,7 @@
 
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
+#include <algorithm>
 #include <bit>
 
 namespace pksm::crypto::swsh
@@ -60,6 +61,29 @@ namespace pksm::crypto::swsh
 
         // clang-format on
 
+        // The xorpad repeated back to back, so that long runs of it can be applied with a plain
+        // elementwise loop (which the compiler can vectorize) instead of a modulus per byte. 64
+        // repetitions also make each run a whole number of SHA-256 blocks
+        constexpr auto expandedXorpad = []
+        {
+            std::array<u8, xorpad.size() * 64> ret{};
+            for (size_t i = 0; i < ret.size(); i++)
+            {
+                ret[i] = xorpad[i % xorpad.size()];
+            }
+            return ret;
+        }();
+
+        // data must start at a multiple of the xorpad's length, and length may not be larger than
+        // expandedXorpad
+        void xorChunk(u8* data, size_t length)
+        {
+            for (size_t i = 0; i < length; i++)
+            {
+                data[i] ^= expandedXorpad[i];
+            }
+        }
+
         std::array<u8, 32> computeHash(u8* data, size_t length)
         {
             SHA256 context;
@@ -113,6 +137,30 @@ namespace pksm::crypto::swsh
             {
                 return next() | (u32(next()) << 8) | (u32(next()) << 16) | (u32(next()) << 24);
             }
+
+            // XORs the next length bytes of keystream into data. Equivalent to calling next() for
+            // each byte, but consumes a whole generated word at a time
+            void apply(u8* data, size_t length)
+            {
+                size_t i = 0;
+                // Use up the remainder of a partially consumed word
+                while (mCounter != 0 && i < length)
+                {
+                    data[i++] ^= next();
+                }
+
+                for (; i + 4 <= length; i += 4)
+                {
+                    LittleEndian::convertFrom<u32>(
+                        data + i, LittleEndian::convertTo<u32>(data + i) ^ mSeed);
+                    advance(mSeed);
+                }
+
+                while (i < length)
+                {
+                    data[i++] ^= next();
+                }
+            }
         };
 
         class CryptoException : public std::exception
@@ -132,9 +180,29 @@ namespace pksm::crypto::swsh
 
     void applyXor(std::shared_ptr<u8[]> data, size_t length)
     {
-        for (size_t i = 0; i < length - 32; i++)
+        for (size_t offset = 0; offset < length - 32; offset += internal::expandedXorpad.size())
+        {
+            internal::xorChunk(data.get() + offset,
+                std::min(internal::expandedXorpad.size(), length - 32 - offset));
+        }
+    }
+
+    void applyXorAndSign(std::shared_ptr<u8[]> data, size_t length)
+    {
+        if (length > 32)
         {
-            data[i] ^= internal::xorpad[i % internal::xorpad.size()];
+            SHA256 context;
+            context.update({internal::hashBegin});
+            for (size_t offset = 0; offset < length - 32;
+                 offset += internal::expandedXorpad.size())
+            {
+                size_t chunkSize = std::min(internal::expandedXorpad.size(), length - 32 - offset);
+                internal::xorChunk(data.get() + offset, chunkSize);
+                context.update(std::span{data.get() + offset, chunkSize});
+            }
+            context.update({internal::hashEnd});
+            auto hash = context.finish();
+            std::copy(hash.begin(), hash.end(), data.get() + length - 32);
         }
     }
 
@@ -164,26 +232,29 @@ namespace pksm::crypto::swsh
         return true;
     }
 
-    std::vector<std::shared_ptr<SCBlock>> getBlockList(std::shared_ptr<u8[]> data, size_t length)
+    std::vector<SCBlock> getBlockList(std::shared_ptr<u8[]> data, size_t length)
     {
-        std::vector<std::shared_ptr<SCBlock>> ret;
+        std::vector<SCBlock> ret;
         size_t offset = 0;
         while (offset < length - 32)
         {
-            ret.emplace_back(new SCBlock(data, offset));
+            ret.emplace_back(SCBlock(data, offset));
         }
 
         return ret;
     }
 
-    SCBlock::SCBlock(std::shared_ptr<u8[]> data, size_t& offset) : data(data), myOffset(offset)
+    SCBlock::SCBlock(std::shared_ptr<u8[]> data, size_t& offset)
+        : data(data), myOffset(offset), blockKey(LittleEndian::convertTo<u32>(&data[offset]))
     {
         // Key size
         offset += 4;
 
+        // Only the header is decoded here, and it is decoded without being written back so that
+        // the whole block can be decrypted at once if and when it's needed
         internal::XorShift32 xorShift(key());
 
-        type = SCBlockType(data[offset] ^= xorShift.next());
+        type = SCBlockType(data[offset] ^ xorShift.next());
 
         switch (type)
         {
@@ -194,33 +265,18 @@ namespace pksm::crypto::swsh
                 offset++;
                 break;
             case SCBlockType::Object:
-            {
                 dataLength =
                     LittleEndian::convertTo<u32>(data.get() + offset + 1) ^ xorShift.next32();
-                LittleEndian::convertFrom<u32>(data.get() + offset + 1, dataLength);
-                for (size_t i = 0; i < dataLength; i++)
-                {
-                    data[offset + 5 + i] ^= xorShift.next();
-                }
                 offset += 5 + dataLength;
-            }
-            break;
+                break;
             case SCBlockType::Array:
             {
                 dataLength =
                     LittleEndian::convertTo<u32>(data.get() + offset + 1) ^ xorShift.next32();
-                LittleEndian::convertFrom<u32>(data.get() + offset + 1, dataLength);
-                subtype = SCBlockType(data[offset + 5] ^= xorShift.next());
+                subtype = SCBlockType(data[offset + 5] ^ xorShift.next());
                 switch (subtype)
                 {
                     case SCBlockType::Bool3:
-                        // An array of booleans
-                        for (size_t i = 0; i < dataLength; i++)
-                        {
-                            data[offset + 6 + i] ^= xorShift.next();
-                        }
-                        offset += 6 + dataLength;
-                        break;
                     case SCBlockType::U8:
                     case SCBlockType::U16:
                     case SCBlockType::U32:
@@ -231,15 +287,9 @@ namespace pksm::crypto::swsh
                     case SCBlockType::S64:
                     case SCBlockType::Float:
                     case SCBlockType::Double:
-                    {
-                        size_t entrySize = arrayEntrySize(subtype);
-                        for (size_t i = 0; i < dataLength * entrySize; i++)
-                        {
-                            data[offset + 6 + i] ^= xorShift.next();
-                        }
-                        offset += 6 + (dataLength * entrySize);
-                    }
-                    break;
+                        // Bool3 is an array of booleans, one byte each
+                        offset += 6 + (dataLength * arrayEntrySize(subtype));
+                        break;
                     default:
                         throw internal::CryptoException(
                             "Decoding block: Key: " + std::to_string(key()) +
@@ -257,15 +307,8 @@ namespace pksm::crypto::swsh
             case SCBlockType::S64:
             case SCBlockType::Float:
             case SCBlockType::Double:
-            {
-                size_t entrySize = arrayEntrySize(type);
-                for (size_t i = 0; i < entrySize; i++)
-                {
-                    data[offset + 1 + i] ^= xorShift.next();
-                }
-                offset += 1 + entrySize;
-            }
-            break;
+                offset += 1 + arrayEntrySize(type);
+                break;
             default:
                 throw internal::CryptoException("Decoding block: Key: " + std::to_string(key()) +
                                                 "\nType: " + std::to_string(u8(type)));
@@ -277,10 +320,7 @@ namespace pksm::crypto::swsh
         if (!currentlyEncrypted)
         {
             internal::XorShift32 xorShift(key());
-            for (size_t i = 0; i < encryptedDataSize() - 4; i++)
-            {
-                data[myOffset + 4 + i] ^= xorShift.next();
-            }
+            xorShift.apply(data.get() + myOffset + 4, encryptedDataSize() - 4);
 
             currentlyEncrypted = true;
         }
@@ -291,23 +331,16 @@ namespace pksm::crypto::swsh
         if (currentlyEncrypted)
         {
             internal::XorShift32 xorShift(key());
-            for (size_t i = 0; i < encryptedDataSize() - 4; i++)
-            {
-                data[myOffset + 4 + i] ^= xorShift.next();
-            }
+            xorShift.apply(data.get() + myOffset + 4, encryptedDataSize() - 4);
 
             currentlyEncrypted = false;
         }
     }
 
-    u32 SCBlock::key() const
-    {
-        return LittleEndian::convertTo<u32>(&data[myOffset]);
-    }
-
     void SCBlock::key(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[myOffset], v);
+        blockKey = v;
     }
 
     size_t SCBlock::arrayEntrySize(SCBlockType type)
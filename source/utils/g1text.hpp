@@ -27,6 +27,7 @@
 #ifndef G1TEXT_HPP
 #define G1TEXT_HPP
 
+#include "charmap.hpp"
 #include "utils/coretypes.h"
 #include <unordered_map>
 
@@ -81,6 +82,11 @@ namespace pksm::internal
         u'や', u'ゆ', u'よ', u'ら', u'リ', u'る', u'れ', u'ろ', u'わ', u'を', u'ん', u'っ', u'ゃ',
         u'ゅ', u'ょ', u'ー', u'?', u'!', u'ァ', u'ゥ', u'ェ', u'♂', u'ォ', u'♀', u'０', u'１',
         u'２', u'３', u'４', u'５', u'６', u'７', u'８', u'９'};
+
+    constexpr auto G1ENValueToChar = charsByValue<0x100>(G1ENChars, G1ENVals);
+    constexpr ValuesByChar G1ENCharToValue{G1ENChars, G1ENVals};
+    constexpr auto G1JPValueToChar = charsByValue<0x100>(G1JPChars, G1JPVals);
+    constexpr ValuesByChar G1JPCharToValue{G1JPChars, G1JPVals};
 }
 
 #endif
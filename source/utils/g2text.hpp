@@ -27,6 +27,7 @@
 #ifndef G2TEXT_HPP
 #define G2TEXT_HPP
 
+#include "charmap.hpp"
 #include "utils/coretypes.h"
 #include <unordered_map>
 #include <vector>
@@ -418,6 +419,10 @@ namespace pksm::internal
         0xB2D, 0xB2E, 0xB2F, 0xB30, 0xB31, 0xB32, 0xB33, 0xB34, 0xB3E, 0xB3F, 0xB60, 0xB61, 0xB62,
         0xB63, 0xB64, 0xB65, 0xB66, 0xB67, 0xB68, 0xB69, 0xB6A, 0xB6B, 0xB6C, 0xBF0, 0xBF1, 0xBF2,
         0xBF3, 0xBF4, 0xBF5, 0xBF6, 0xBF7, 0xBF8, 0xBF9, 0xBFF};
+
+    // Korean values are two bytes, and the first is never more than 0x0B
+    constexpr auto G2KORValueToChar = charsByValue<0xC00>(G2KORChars, G2KORVals);
+    constexpr ValuesByChar G2KORCharToValue{G2KORChars, G2KORVals};
 }
 
 #endif
@@ -27,6 +27,7 @@
 #ifndef G3TEXT_HPP
 #define G3TEXT_HPP
 
+#include "charmap.hpp"
 #include <array>
 
 namespace pksm::internal
@@ -71,6 +72,10 @@ namespace pksm::internal
         u'ｃ', u'ｄ', u'ｅ', u'ｆ', u'ｇ', u'ｈ', u'ｉ', u'ｊ', u'ｋ', u'ｌ', u'ｍ', u'ｎ', u'ｏ',
         u'ｐ', u'ｑ', u'ｒ', u'ｓ', u'ｔ', u'ｕ', u'ｖ', u'ｗ', u'ｘ', u'ｙ', u'ｚ', u'0', u':',
         u'Ä', u'Ö', u'Ü', u'ä', u'ö', u'ü'};
+
+    // A character's value is its index in the tables above
+    constexpr ValuesByChar G3_ENCharToValue{G3_EN, charmapIndices<u8, G3_EN.size()>()};
+    constexpr ValuesByChar G3_JPCharToValue{G3_JP, charmapIndices<u8, G3_JP.size()>()};
 }
 
 #endif
@@ -27,7 +27,9 @@
 #ifndef G4TEXT_H
 #define G4TEXT_H
 
+#include "charmap.hpp"
 #include "utils/coretypes.h"
+#include <algorithm>
 #include <array>
 
 namespace pksm::internal
@@ -436,6 +438,25 @@ namespace pksm::internal
         4357, 4358, 4359, 4360, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4449,
         4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4461, 4462, 4466, 4467, 4469, 47252, 49968,
         50108, 50388, 52012, 65535};
+
+    // Inverses of the two tables above, so that neither direction needs to search them
+
+    // The largest value G4Values maps to a character; 0xFFFF is only ever the terminator
+    inline constexpr u16 G4MaxValue = []()
+    {
+        u16 ret = 0;
+        for (const u16 value : G4Values)
+        {
+            if (value != 0xFFFF)
+            {
+                ret = std::max(ret, value);
+            }
+        }
+        return ret;
+    }();
+
+    inline constexpr auto G4ValueToChar = charsByValue<G4MaxValue + 1>(G4Chars, G4Values);
+    inline constexpr ValuesByChar G4CharToValue{G4Chars, G4Values};
 }
 
 #endif
@@ -25,6 +25,7 @@
  */
 
 #include "utils/io.hpp"
+#include <cstdio>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -33,3 +34,43 @@ bool io::exists(const std::string& name)
     struct stat buffer;
     return (stat(name.c_str(), &buffer) == 0);
 }
+
+bool io::modified(const std::string& name, s64& time)
+{
+    struct stat buffer;
+    if (stat(name.c_str(), &buffer) != 0)
+    {
+        return false;
+    }
+    time = buffer.st_mtime;
+    return true;
+}
+
+std::shared_ptr<u8[]> io::read(const std::string& name, size_t& size)
+{
+    FILE* file = fopen(name.c_str(), "rb");
+    if (!file)
+    {
+        return nullptr;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long fileSize = ftell(file);
+    rewind(file);
+
+    std::shared_ptr<u8[]> ret = nullptr;
+    if (fileSize > 0)
+    {
+        ret = std::shared_ptr<u8[]>{new u8[fileSize]};
+        if (fread(ret.get(), 1, fileSize, file) == size_t(fileSize))
+        {
+            size = fileSize;
+        }
+        else
+        {
+            ret = nullptr;
+        }
+    }
+    fclose(file);
+    return ret;
+}
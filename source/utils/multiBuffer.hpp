@@ -0,0 +1,215 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62, Pk11
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef MULTI_BUFFER_HPP
+#define MULTI_BUFFER_HPP
+
+#include "cpuFeatures.hpp"
+#include "utils/coretypes.h"
+#include <algorithm>
+#include <array>
+#include <span>
+
+#ifdef PKSMCORE_X86_SHA
+#include <immintrin.h>
+#endif
+
+namespace pksm::crypto::internal
+{
+    constexpr size_t MultiBufferLanes = 8;
+
+    // State of every lane, one row per state word so that each row is one vector
+    template <size_t StateWords>
+    using MultiBufferState = std::array<std::array<u32, MultiBufferLanes>, StateWords>;
+
+    // Hashes every buffer with a Merkle-Damgard hash that uses SHA-style padding, eight messages
+    // at a time. kernel(state, blocks) must hash one 64-byte block per lane; finish(index, state)
+    // is called with the final state of buffers[index]. Whenever a lane's message runs out, the
+    // next buffer is started in it, so lanes stay busy even when the lengths differ
+    template <size_t StateWords, typename Kernel, typename Finish>
+    void hashMultiBuffer(std::span<const std::span<const u8>> buffers,
+        const std::array<u32, StateWords>& initialState, Kernel&& kernel, Finish&& finish)
+    {
+        struct Lane
+        {
+            const u8* data;
+            size_t fullBlocks;
+            size_t totalBlocks;
+            size_t nextBlock;
+            size_t index;
+            bool active = false;
+            // Leftover bytes, padding and length
+            u8 tail[128];
+        };
+
+        static constexpr u8 idleBlock[64] = {};
+
+        std::array<Lane, MultiBufferLanes> lanes;
+        MultiBufferState<StateWords> state;
+        size_t nextBuffer = 0;
+
+        while (true)
+        {
+            size_t activeLanes = 0;
+            for (size_t lane = 0; lane < MultiBufferLanes; lane++)
+            {
+                Lane& current = lanes[lane];
+                if (!current.active && nextBuffer < buffers.size())
+                {
+                    const std::span<const u8> buffer = buffers[nextBuffer];
+                    const size_t leftover            = buffer.size() % 64;
+                    const size_t tailLength          = leftover < 56 ? 64 : 128;
+                    const u64 bitLength              = u64(buffer.size()) * 8;
+
+                    current.data        = buffer.data();
+                    current.fullBlocks  = buffer.size() / 64;
+                    current.totalBlocks = current.fullBlocks + tailLength / 64;
+                    current.nextBlock   = 0;
+                    current.index       = nextBuffer++;
+                    current.active      = true;
+
+                    std::copy(buffer.end() - leftover, buffer.end(), current.tail);
+                    current.tail[leftover] = 0x80;
+                    std::fill(current.tail + leftover + 1, current.tail + tailLength - 8, 0);
+                    for (size_t i = 0; i < 8; i++)
+                    {
+                        current.tail[tailLength - 1 - i] = u8(bitLength >> (i * 8));
+                    }
+
+                    for (size_t word = 0; word < StateWords; word++)
+                    {
+                        state[word][lane] = initialState[word];
+                    }
+                }
+                if (current.active)
+                {
+                    activeLanes++;
+                }
+            }
+
+            if (activeLanes == 0)
+            {
+                break;
+            }
+
+            std::array<const u8*, MultiBufferLanes> blocks;
+            for (size_t lane = 0; lane < MultiBufferLanes; lane++)
+            {
+                const Lane& current = lanes[lane];
+                if (!current.active)
+                {
+                    blocks[lane] = idleBlock;
+                }
+                else if (current.nextBlock < current.fullBlocks)
+                {
+                    blocks[lane] = current.data + current.nextBlock * 64;
+                }
+                else
+                {
+                    blocks[lane] = current.tail + (current.nextBlock - current.fullBlocks) * 64;
+                }
+            }
+
+            kernel(state, blocks);
+
+            for (size_t lane = 0; lane < MultiBufferLanes; lane++)
+            {
+                Lane& current = lanes[lane];
+                if (current.active && ++current.nextBlock == current.totalBlocks)
+                {
+                    std::array<u32, StateWords> laneState;
+                    for (size_t word = 0; word < StateWords; word++)
+                    {
+                        laneState[word] = state[word][lane];
+                    }
+                    finish(current.index, laneState);
+                    current.active = false;
+                }
+            }
+        }
+    }
+
+#ifdef PKSMCORE_X86_SHA
+    // Loads the 16 big-endian message words of one block per lane, transposed so that words[i]
+    // holds word i of every lane
+    __attribute__((target("avx2"))) inline void loadBlocksAvx2(
+        const std::array<const u8*, MultiBufferLanes>& blocks, __m256i (&words)[16])
+    {
+        const __m256i byteSwap = _mm256_set_epi64x(0x0C0D0E0F08090A0BULL, 0x0405060700010203ULL,
+            0x0C0D0E0F08090A0BULL, 0x0405060700010203ULL);
+
+        for (size_t half = 0; half < 2; half++)
+        {
+            __m256i rows[8];
+            for (size_t lane = 0; lane < MultiBufferLanes; lane++)
+            {
+                rows[lane] = _mm256_loadu_si256((const __m256i*)(blocks[lane] + half * 32));
+            }
+
+            __m256i pairs[8];
+            for (size_t i = 0; i < 8; i += 4)
+            {
+                pairs[i + 0] = _mm256_unpacklo_epi32(rows[i + 0], rows[i + 1]);
+                pairs[i + 1] = _mm256_unpackhi_epi32(rows[i + 0], rows[i + 1]);
+                pairs[i + 2] = _mm256_unpacklo_epi32(rows[i + 2], rows[i + 3]);
+                pairs[i + 3] = _mm256_unpackhi_epi32(rows[i + 2], rows[i + 3]);
+            }
+
+            __m256i quads[8];
+            for (size_t i = 0; i < 8; i += 4)
+            {
+                quads[i + 0] = _mm256_unpacklo_epi64(pairs[i + 0], pairs[i + 2]);
+                quads[i + 1] = _mm256_unpackhi_epi64(pairs[i + 0], pairs[i + 2]);
+                quads[i + 2] = _mm256_unpacklo_epi64(pairs[i + 1], pairs[i + 3]);
+                quads[i + 3] = _mm256_unpackhi_epi64(pairs[i + 1], pairs[i + 3]);
+            }
+
+            __m256i* out = words + half * 8;
+            for (size_t i = 0; i < 4; i++)
+            {
+                out[i] = _mm256_shuffle_epi8(
+                    _mm256_permute2x128_si256(quads[i], quads[i + 4], 0x20), byteSwap);
+                out[i + 4] = _mm256_shuffle_epi8(
+                    _mm256_permute2x128_si256(quads[i], quads[i + 4], 0x31), byteSwap);
+            }
+        }
+    }
+
+    template <int Bits>
+    __attribute__((target("avx2"))) inline __m256i rotlAvx2(__m256i x)
+    {
+        return _mm256_or_si256(_mm256_slli_epi32(x, Bits), _mm256_srli_epi32(x, 32 - Bits));
+    }
+
+    template <int Bits>
+    __attribute__((target("avx2"))) inline __m256i rotrAvx2(__m256i x)
+    {
+        return rotlAvx2<32 - Bits>(x);
+    }
+#endif
+}
+
+#endif
@@ -25,6 +25,7 @@
  */
 
 #include "utils/utils.hpp"
+#include "charmap.hpp"
 #include "g1text.hpp"
 #include "g2text.hpp"
 #include "g3text.hpp"
@@ -38,314 +39,146 @@
 
 namespace
 {
-    char32_t swapCodepoints45(char32_t codepoint)
+    // The characters transString45 and transString67 swap, and what they swap them with
+    constexpr std::array<char16_t, 80> TRANS45_FROM = {u'\u2227', u'\u2228', u'\u2460', u'\u2461',
+        u'\u2462', u'\u2463', u'\u2464', u'\u2465', u'\u2466', u'\u2469', u'\u246A', u'\u246B',
+        u'\u246C', u'\u246D', u'\u246E', u'\u246F', u'\u2470', u'\u2471', u'\u2472', u'\u2473',
+        u'\u2474', u'\u2475', u'\u2476', u'\u2477', u'\u2478', u'\u2479', u'\u247A', u'\u247B',
+        u'\u247C', u'\u247D', u'\u247E', u'\u247F', u'\u2480', u'\u2481', u'\u2482', u'\u2483',
+        u'\u2484', u'\u2485', u'\u2486', u'\u2487', u'\uE0A9', u'\uE0AA', u'\uE081', u'\uE082',
+        u'\uE083', u'\uE084', u'\uE085', u'\uE086', u'\uE087', u'\uE068', u'\uE069', u'\uE0AB',
+        u'\uE08D', u'\uE08E', u'\uE08F', u'\uE090', u'\uE091', u'\uE092', u'\uE093', u'\uE094',
+        u'\uE095', u'\uE096', u'\uE097', u'\uE098', u'\uE099', u'\uE09A', u'\uE09B', u'\uE09C',
+        u'\uE09D', u'\uE09E', u'\uE09F', u'\uE0A0', u'\uE0A1', u'\uE0A2', u'\uE0A3', u'\uE0A4',
+        u'\uE0A5', u'\uE06A', u'\uE0A7', u'\uE0A8'};
+    constexpr std::array<char16_t, 80> TRANS45_TO = {u'\uE0A9', u'\uE0AA', u'\uE081', u'\uE082',
+        u'\uE083', u'\uE084', u'\uE085', u'\uE086', u'\uE087', u'\uE068', u'\uE069', u'\uE0AB',
+        u'\uE08D', u'\uE08E', u'\uE08F', u'\uE090', u'\uE091', u'\uE092', u'\uE093', u'\uE094',
+        u'\uE095', u'\uE096', u'\uE097', u'\uE098', u'\uE099', u'\uE09A', u'\uE09B', u'\uE09C',
+        u'\uE09D', u'\uE09E', u'\uE09F', u'\uE0A0', u'\uE0A1', u'\uE0A2', u'\uE0A3', u'\uE0A4',
+        u'\uE0A5', u'\uE06A', u'\uE0A7', u'\uE0A8', u'\u2227', u'\u2228', u'\u2460', u'\u2461',
+        u'\u2462', u'\u2463', u'\u2464', u'\u2465', u'\u2466', u'\u2469', u'\u246A', u'\u246B',
+        u'\u246C', u'\u246D', u'\u246E', u'\u246F', u'\u2470', u'\u2471', u'\u2472', u'\u2473',
+        u'\u2474', u'\u2475', u'\u2476', u'\u2477', u'\u2478', u'\u2479', u'\u247A', u'\u247B',
+        u'\u247C', u'\u247D', u'\u247E', u'\u247F', u'\u2480', u'\u2481', u'\u2482', u'\u2483',
+        u'\u2484', u'\u2485', u'\u2486', u'\u2487'};
+    constexpr pksm::internal::ValuesByChar TRANS45{TRANS45_FROM, TRANS45_TO};
+
+    constexpr std::array<char16_t, 12> TRANS67_FROM = {u'\uE088', u'\uE089', u'\uE08A', u'\uE08B',
+        u'\uE08C', u'\uE0A6', u'\u00D7', u'\u00F7', u'\uE068', u'\uE069', u'\uE0AB', u'\uE06A'};
+    constexpr std::array<char16_t, 12> TRANS67_TO = {u'\u00D7', u'\u00F7', u'\uE068', u'\uE069',
+        u'\uE0AB', u'\uE06A', u'\uE088', u'\uE089', u'\uE08A', u'\uE08B', u'\uE08C', u'\uE0A6'};
+    constexpr pksm::internal::ValuesByChar TRANS67{TRANS67_FROM, TRANS67_TO};
+
+    // Converts a single latin character from half-width to full-width
+    char16_t tofullwidth(char16_t c)
     {
-        switch (codepoint)
+        if (c == ' ')
         {
-            case u'\u2227':
-                codepoint = u'\uE0A9';
-                break;
-            case u'\u2228':
-                codepoint = u'\uE0AA';
-                break;
-            case u'\u2460':
-                codepoint = u'\uE081';
-                break;
-            case u'\u2461':
-                codepoint = u'\uE082';
-                break;
-            case u'\u2462':
-                codepoint = u'\uE083';
-                break;
-            case u'\u2463':
-                codepoint = u'\uE084';
-                break;
-            case u'\u2464':
-                codepoint = u'\uE085';
-                break;
-            case u'\u2465':
-                codepoint = u'\uE086';
-                break;
-            case u'\u2466':
-                codepoint = u'\uE087';
-                break;
-            case u'\u2469':
-                codepoint = u'\uE068';
-                break;
-            case u'\u246A':
-                codepoint = u'\uE069';
-                break;
-            case u'\u246B':
-                codepoint = u'\uE0AB';
-                break;
-            case u'\u246C':
-                codepoint = u'\uE08D';
-                break;
-            case u'\u246D':
-                codepoint = u'\uE08E';
-                break;
-            case u'\u246E':
-                codepoint = u'\uE08F';
-                break;
-            case u'\u246F':
-                codepoint = u'\uE090';
-                break;
-            case u'\u2470':
-                codepoint = u'\uE091';
-                break;
-            case u'\u2471':
-                codepoint = u'\uE092';
-                break;
-            case u'\u2472':
-                codepoint = u'\uE093';
-                break;
-            case u'\u2473':
-                codepoint = u'\uE094';
-                break;
-            case u'\u2474':
-                codepoint = u'\uE095';
-                break;
-            case u'\u2475':
-                codepoint = u'\uE096';
-                break;
-            case u'\u2476':
-                codepoint = u'\uE097';
-                break;
-            case u'\u2477':
-                codepoint = u'\uE098';
-                break;
-            case u'\u2478':
-                codepoint = u'\uE099';
-                break;
-            case u'\u2479':
-                codepoint = u'\uE09A';
-                break;
-            case u'\u247A':
-                codepoint = u'\uE09B';
-                break;
-            case u'\u247B':
-                codepoint = u'\uE09C';
-                break;
-            case u'\u247C':
-                codepoint = u'\uE09D';
-                break;
-            case u'\u247D':
-                codepoint = u'\uE09E';
-                break;
-            case u'\u247E':
-                codepoint = u'\uE09F';
-                break;
-            case u'\u247F':
-                codepoint = u'\uE0A0';
-                break;
-            case u'\u2480':
-                codepoint = u'\uE0A1';
-                break;
-            case u'\u2481':
-                codepoint = u'\uE0A2';
-                break;
-            case u'\u2482':
-                codepoint = u'\uE0A3';
-                break;
-            case u'\u2483':
-                codepoint = u'\uE0A4';
-                break;
-            case u'\u2484':
-                codepoint = u'\uE0A5';
-                break;
-            case u'\u2485':
-                codepoint = u'\uE06A';
-                break;
-            case u'\u2486':
-                codepoint = u'\uE0A7';
-                break;
-            case u'\u2487':
-                codepoint = u'\uE0A8';
-                break;
-
-            case u'\uE0A9':
-                codepoint = u'\u2227';
-                break;
-            case u'\uE0AA':
-                codepoint = u'\u2228';
-                break;
-            case u'\uE081':
-                codepoint = u'\u2460';
-                break;
-            case u'\uE082':
-                codepoint = u'\u2461';
-                break;
-            case u'\uE083':
-                codepoint = u'\u2462';
-                break;
-            case u'\uE084':
-                codepoint = u'\u2463';
-                break;
-            case u'\uE085':
-                codepoint = u'\u2464';
-                break;
-            case u'\uE086':
-                codepoint = u'\u2465';
-                break;
-            case u'\uE087':
-                codepoint = u'\u2466';
-                break;
-            case u'\uE068':
-                codepoint = u'\u2469';
-                break;
-            case u'\uE069':
-                codepoint = u'\u246A';
-                break;
-            case u'\uE0AB':
-                codepoint = u'\u246B';
-                break;
-            case u'\uE08D':
-                codepoint = u'\u246C';
-                break;
-            case u'\uE08E':
-                codepoint = u'\u246D';
-                break;
-            case u'\uE08F':
-                codepoint = u'\u246E';
-                break;
-            case u'\uE090':
-                codepoint = u'\u246F';
-                break;
-            case u'\uE091':
-                codepoint = u'\u2470';
-                break;
-            case u'\uE092':
-                codepoint = u'\u2471';
-                break;
-            case u'\uE093':
-                codepoint = u'\u2472';
-                break;
-            case u'\uE094':
-                codepoint = u'\u2473';
-                break;
-            case u'\uE095':
-                codepoint = u'\u2474';
-                break;
-            case u'\uE096':
-                codepoint = u'\u2475';
-                break;
-            case u'\uE097':
-                codepoint = u'\u2476';
-                break;
-            case u'\uE098':
-                codepoint = u'\u2477';
-                break;
-            case u'\uE099':
-                codepoint = u'\u2478';
-                break;
-            case u'\uE09A':
-                codepoint = u'\u2479';
-                break;
-            case u'\uE09B':
-                codepoint = u'\u247A';
-                break;
-            case u'\uE09C':
-                codepoint = u'\u247B';
-                break;
-            case u'\uE09D':
-                codepoint = u'\u247C';
-                break;
-            case u'\uE09E':
-                codepoint = u'\u247D';
-                break;
-            case u'\uE09F':
-                codepoint = u'\u247E';
-                break;
-            case u'\uE0A0':
-                codepoint = u'\u247F';
-                break;
-            case u'\uE0A1':
-                codepoint = u'\u2480';
-                break;
-            case u'\uE0A2':
-                codepoint = u'\u2481';
-                break;
-            case u'\uE0A3':
-                codepoint = u'\u2482';
-                break;
-            case u'\uE0A4':
-                codepoint = u'\u2483';
-                break;
-            case u'\uE0A5':
-                codepoint = u'\u2484';
-                break;
-            case u'\uE06A':
-                codepoint = u'\u2485';
-                break;
-            case u'\uE0A7':
-                codepoint = u'\u2486';
-                break;
-            case u'\uE0A8':
-                codepoint = u'\u2487';
-                break;
-            default:
-                break;
+            c = u'　';
         }
-        return codepoint;
+        else if (c >= '!' && c <= '~')
+        {
+            c += 0xFEE0;
+        }
+        return c;
     }
 
-    char32_t swapCodepoints67(char32_t codepoint)
+    // Where the string decoders put each codepoint they decode. put returns false once nothing
+    // more fits, which ends the string
+    class StringWriter
     {
-        switch (codepoint)
-        {
-            case u'\uE088':
-                codepoint = u'\u00D7';
-                break;
-            case u'\uE089':
-                codepoint = u'\u00F7';
-                break;
-            case u'\uE08A':
-                codepoint = u'\uE068';
-                break;
-            case u'\uE08B':
-                codepoint = u'\uE069';
-                break;
-            case u'\uE08C':
-                codepoint = u'\uE0AB';
-                break;
-            case u'\uE0A6':
-                codepoint = u'\uE06A';
-                break;
+    public:
+        explicit StringWriter(std::string& out) : out(out) {}
 
-            case u'\u00D7':
-                codepoint = u'\uE088';
-                break;
-            case u'\u00F7':
-                codepoint = u'\uE089';
-                break;
-            case u'\uE068':
-                codepoint = u'\uE08A';
-                break;
-            case u'\uE069':
-                codepoint = u'\uE08B';
-                break;
-            case u'\uE0AB':
-                codepoint = u'\uE08C';
-                break;
-            case u'\uE06A':
-                codepoint = u'\uE0A6';
-                break;
+        bool put(char32_t codepoint)
+        {
+            auto [data, size] = StringUtils::codepointToUTF8(codepoint);
+            out.append(data.data(), size);
+            return true;
         }
-        return codepoint;
-    }
 
-    // Converts a single latin character from half-width to full-width
-    char16_t tofullwidth(char16_t c)
+    private:
+        std::string& out;
+    };
+
+    // Writes UTF-8 into a caller's buffer without splitting a codepoint, always leaving room to
+    // terminate it
+    class BufferWriter
     {
-        if (c == ' ')
+    public:
+        explicit BufferWriter(std::span<char> out) : out(out) {}
+
+        bool put(char32_t codepoint)
         {
-            c = u'　';
+            auto [data, size] = StringUtils::codepointToUTF8(codepoint);
+            if (written + size >= out.size())
+            {
+                return false;
+            }
+            std::copy_n(data.data(), size, out.data() + written);
+            written += size;
+            return true;
         }
-        else if (c >= '!' && c <= '~')
+
+        // Terminates what was written and returns its length
+        size_t finish(void)
         {
-            c += 0xFEE0;
+            if (!out.empty())
+            {
+                out[written] = '\0';
+            }
+            return written;
         }
-        return c;
+
+    private:
+        std::span<char> out;
+        size_t written = 0;
+    };
+
+    // Decodes len characters with next(i), which returns the ith one, stopping at term, then
+    // applies trans to them and writes them out. Characters go through a small buffer so that
+    // trans can work in place. As in the std::string versions, which translate after a trip
+    // through UTF-16, surrogates become U+FFFD when translating
+    template <typename Next>
+    size_t decodeUCS2(int len, char16_t term, void (*trans)(char16_t*, size_t),
+        std::span<char> out, const Next& next)
+    {
+        BufferWriter writer{out};
+        std::array<char16_t, 32> chunk;
+        bool done = false;
+        for (int i = 0; i < len && !done;)
+        {
+            size_t count = 0;
+            for (; i < len && count < chunk.size(); i++)
+            {
+                char16_t codeunit = next(i);
+                if (codeunit == term)
+                {
+                    done = true;
+                    break;
+                }
+                if (trans && (codeunit & 0xF800) == 0xD800)
+                {
+                    codeunit = u'\uFFFD';
+                }
+                chunk[count++] = codeunit;
+            }
+
+            if (trans)
+            {
+                trans(chunk.data(), count);
+            }
+            for (size_t j = 0; j < count; j++)
+            {
+                if (!writer.put(chunk[j]))
+                {
+                    done = true;
+                    break;
+                }
+            }
+        }
+        return writer.finish();
     }
 }
 
@@ -655,6 +488,13 @@ std::string StringUtils::getString(const u8* data, int ofs, int len, char16_t te
     return ret;
 }
 
+size_t StringUtils::getString(const u8* data, int ofs, int len, std::span<char> out,
+    char16_t term, void (*trans)(char16_t*, size_t))
+{
+    return decodeUCS2(len, term, trans, out,
+        [data, ofs](int i) { return LittleEndian::convertTo<char16_t>(data + ofs + i * 2); });
+}
+
 void StringUtils::setString(
     u8* data, const std::u32string_view& v, int ofs, int len, char16_t terminator, char16_t padding)
 {
@@ -719,15 +559,12 @@ std::string StringUtils::getString4(const u8* data, int ofs, int len)
         {
             break;
         }
-        auto found =
-            std::find(pksm::internal::G4Values.begin(), pksm::internal::G4Values.end(), temp);
         // Treat an invalid value as a terminator
-        if (found == pksm::internal::G4Values.end())
+        if (temp > pksm::internal::G4MaxValue)
         {
             break;
         }
-        u16 codepoint =
-            pksm::internal::G4Chars[std::distance(pksm::internal::G4Values.begin(), found)];
+        u16 codepoint = pksm::internal::G4ValueToChar[temp];
         if (codepoint == 0xFFFF)
         {
             break;
@@ -738,6 +575,19 @@ std::string StringUtils::getString4(const u8* data, int ofs, int len)
     return output;
 }
 
+size_t StringUtils::getString4(
+    const u8* data, int ofs, int len, std::span<char> out, void (*trans)(char16_t*, size_t))
+{
+    // Invalid values are treated as terminators, same as above
+    return decodeUCS2(len, u'\uFFFF', trans, out,
+        [data, ofs](int i)
+        {
+            u16 value = LittleEndian::convertTo<u16>(data + ofs + i * 2);
+            return value > pksm::internal::G4MaxValue ? u'\uFFFF'
+                                                      : pksm::internal::G4ValueToChar[value];
+        });
+}
+
 std::vector<u16> StringUtils::stringToG4(const std::string_view& v)
 {
     std::vector<u16> ret;
@@ -746,12 +596,7 @@ std::vector<u16> StringUtils::stringToG4(const std::string_view& v)
     {
         auto [codepoint, size] = UTF8toCodepoint(v.data() + charIndex, v.length() - charIndex);
 
-        auto found =
-            std::find(pksm::internal::G4Chars.begin(), pksm::internal::G4Chars.end(), codepoint);
-        ret.push_back(
-            found != pksm::internal::G4Chars.end()
-                ? pksm::internal::G4Values[std::distance(pksm::internal::G4Chars.begin(), found)]
-                : 0x0000);
+        ret.push_back(pksm::internal::G4CharToValue[codepoint].value_or(0x0000));
 
         charIndex += size;
     }
@@ -769,12 +614,8 @@ void StringUtils::setString4(u8* data, const std::string_view& v, int ofs, int l
     {
         auto [codepoint, size] = UTF8toCodepoint(v.data() + charIndex, v.length() - charIndex);
 
-        auto found =
-            std::find(pksm::internal::G4Chars.begin(), pksm::internal::G4Chars.end(), codepoint);
         LittleEndian::convertFrom<u16>(data + ofs + outIndex++ * 2,
-            found != pksm::internal::G4Chars.end()
-                ? pksm::internal::G4Values[std::distance(pksm::internal::G4Chars.begin(), found)]
-                : 0x0000);
+            pksm::internal::G4CharToValue[codepoint].value_or(0x0000));
 
         charIndex += size;
     }
@@ -839,72 +680,219 @@ std::u16string& StringUtils::toFullWidth(std::u16string& in)
 
 std::string StringUtils::transString45(const std::string_view& str)
 {
-    return UTF16toUTF8(transString45(UTF8toUTF16(str)));
+    std::u16string ret = UTF8toUTF16(str);
+    transString45(ret.data(), ret.size());
+    return UTF16toUTF8(ret);
 }
 
 std::u16string StringUtils::transString45(const std::u16string_view& str)
 {
     std::u16string ret = std::u16string(str);
-    std::transform(str.begin(), str.end(), ret.begin(),
-        [](const char16_t& chr) { return (char16_t)swapCodepoints45(chr); });
+    transString45(ret.data(), ret.size());
     return ret;
 }
 
+void StringUtils::transString45(char16_t* str, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        str[i] = TRANS45[str[i]].value_or(str[i]);
+    }
+}
+
 std::string StringUtils::transString67(const std::string_view& str)
 {
-    return UTF16toUTF8(transString67(UTF8toUTF16(str)));
+    std::u16string ret = UTF8toUTF16(str);
+    transString67(ret.data(), ret.size());
+    return UTF16toUTF8(ret);
 }
 
 std::u16string StringUtils::transString67(const std::u16string_view& str)
 {
     std::u16string ret = std::u16string(str);
-    std::transform(str.begin(), str.end(), ret.begin(),
-        [](const char16_t& chr) { return (char16_t)swapCodepoints67(chr); });
+    transString67(ret.data(), ret.size());
     return ret;
 }
 
-std::string StringUtils::getString3(const u8* data, int ofs, int len, bool jp)
+void StringUtils::transString67(char16_t* str, size_t length)
 {
-    auto& characters = jp ? pksm::internal::G3_JP : pksm::internal::G3_EN;
-    std::u16string outString;
+    for (size_t i = 0; i < length; i++)
+    {
+        str[i] = TRANS67[str[i]].value_or(str[i]);
+    }
+}
 
-    for (int i = 0; i < len; i++)
+namespace
+{
+    template <typename Writer>
+    void decodeString3(const u8* data, int ofs, int len, bool jp, Writer& out)
     {
-        if (data[ofs + i] < characters.size())
+        auto& characters = jp ? pksm::internal::G3_JP : pksm::internal::G3_EN;
+        for (int i = 0; i < len; i++)
         {
-            outString += characters[data[ofs + i]];
+            if (data[ofs + i] >= characters.size() || !out.put(characters[data[ofs + i]]))
+            {
+                break;
+            }
         }
-        else
+    }
+
+    template <typename Writer>
+    void decodeString1(
+        const u8* data, int ofs, int len, pksm::Language lang, bool transporter, Writer& out)
+    {
+        if (data[ofs] == 0x5D)
         {
-            break;
+            const std::string tradeOT = transporter
+                                          ? StringUtils::getTradeOT(lang)
+                                          : StringUtils::toUpper(StringUtils::getTradeOT(lang));
+            for (size_t i = 0; i < tradeOT.size();)
+            {
+                auto [codepoint, advance] =
+                    StringUtils::UTF8toCodepoint(tradeOT.data() + i, tradeOT.size() - i);
+                if (!out.put(codepoint))
+                {
+                    break;
+                }
+                i += advance;
+            }
+            return;
+        }
+
+        const bool jp    = lang == pksm::Language::JPN;
+        auto& characters = jp ? pksm::internal::G1JPValueToChar : pksm::internal::G1ENValueToChar;
+        for (int i = 0; i < len; i++)
+        {
+            char16_t codepoint = characters[data[ofs + i]];
+            // treat invalid character as terminator
+            if (codepoint == 0xFFFF || codepoint == u'\0')
+            {
+                break;
+            }
+            if (codepoint == pksm::internal::tradeOTChar)
+            {
+                continue;
+            }
+            if (transporter)
+            {
+                switch (codepoint)
+                {
+                    case u'?':
+                    case u'!':
+                        if (jp)
+                        {
+                            codepoint = u' ';
+                        }
+                        break;
+                    case u'[':
+                        if (!jp)
+                        {
+                            codepoint = u'(';
+                        }
+                        break;
+                    case u']':
+                        if (!jp)
+                        {
+                            codepoint = u')';
+                        }
+                        break;
+                    case u'×':
+                        if (!jp)
+                        {
+                            codepoint = u'x';
+                        }
+                        break;
+                }
+            }
+
+            if (!out.put(codepoint))
+            {
+                break;
+            }
+        }
+    }
+
+    template <typename Writer>
+    void decodeString2KOR(const u8* data, int ofs, int len, Writer& out)
+    {
+        int inPos = 0;
+        while (inPos < len)
+        {
+            char16_t codepoint;
+            if (data[ofs + inPos] <= 0xB)
+            {
+                codepoint = pksm::internal::G2KORValueToChar[BigEndian::convertTo<u16>(
+                    data + ofs + inPos)];
+                if (codepoint == 0xFFFF)
+                {
+                    break; // treat invalid value as terminator
+                }
+
+                inPos += 2;
+            }
+            else
+            {
+                codepoint = pksm::internal::G1ENValueToChar[data[ofs + inPos]];
+                if (codepoint == 0xFFFF || codepoint == u'\0')
+                {
+                    break; // treat invalid value as terminator
+                }
+
+                inPos++;
+
+                if (codepoint == pksm::internal::tradeOTChar)
+                {
+                    continue;
+                }
+            }
+
+            if (!out.put(codepoint))
+            {
+                break;
+            }
         }
     }
+}
+
+std::string StringUtils::getString3(const u8* data, int ofs, int len, bool jp)
+{
+    std::string ret;
+    ret.reserve(len);
+    StringWriter out{ret};
+    decodeString3(data, ofs, len, jp, out);
+    return ret;
+}
 
-    return StringUtils::UTF16toUTF8(outString);
+size_t StringUtils::getString3(const u8* data, int ofs, int len, bool jp, std::span<char> out)
+{
+    BufferWriter writer{out};
+    decodeString3(data, ofs, len, jp, writer);
+    return writer.finish();
 }
 
 void StringUtils::setString3(
     u8* data, const std::string_view& v, int ofs, int len, bool jp, int padTo, u8 padWith)
 {
-    auto& characters   = jp ? pksm::internal::G3_JP : pksm::internal::G3_EN;
-    std::u16string str = StringUtils::UTF8toUTF16(v);
-    if (jp)
-    {
-        str = StringUtils::toFullWidth(str);
-    }
+    auto& characters = jp ? pksm::internal::G3_JPCharToValue : pksm::internal::G3_ENCharToValue;
 
-    size_t outPos;
-    for (outPos = 0; outPos < std::min((size_t)len, str.size()); outPos++)
+    size_t outPos = 0;
+    size_t inPos  = 0;
+    while (outPos < (size_t)len && inPos < v.size())
     {
-        auto it = std::find(characters.begin(), characters.end(), str[outPos]);
-        if (it != characters.end())
+        auto [codepoint, advance] = UTF8toCodepoint(v.data() + inPos, v.size() - inPos);
+        if (jp)
         {
-            data[ofs + outPos] = (u8)std::distance(characters.begin(), it);
+            codepoint = tofullwidth(codepointToUCS2(codepoint));
         }
-        else
+
+        auto value = characters[codepoint];
+        if (!value)
         {
             break;
         }
+        data[ofs + outPos++] = *value;
+
+        inPos += advance;
     }
 
     if (outPos < (size_t)len)
@@ -1009,93 +997,21 @@ void StringUtils::gbStringFailsafe(u8* data, int ofs, int len)
 std::string StringUtils::getString1(
     const u8* data, int ofs, int len, pksm::Language lang, bool transporter)
 {
-    if (data[ofs] == 0x5D)
-    {
-        return transporter ? getTradeOT(lang) : StringUtils::toUpper(getTradeOT(lang));
-    }
-
     std::string ret;
     ret.reserve(len);
-
-    if (lang == pksm::Language::JPN)
-    {
-        for (int i = 0; i < len; i++)
-        {
-            auto found = std::find(
-                pksm::internal::G1JPVals.begin(), pksm::internal::G1JPVals.end(), data[i + ofs]);
-            if (found == pksm::internal::G1JPVals.end())
-            {
-                break; // treat invalid character as terminator
-            }
-            char16_t codepoint =
-                pksm::internal::G1JPChars[std::distance(pksm::internal::G1JPVals.begin(), found)];
-            if (codepoint == u'\0')
-            {
-                break;
-            }
-            if (codepoint == pksm::internal::tradeOTChar)
-            {
-                continue;
-            }
-            if (transporter)
-            {
-                switch (codepoint)
-                {
-                    case u'?':
-                    case u'!':
-                        codepoint = u' ';
-                }
-            }
-
-            auto [data, size] = codepointToUTF8(codepoint);
-
-            ret.append(data.data(), size);
-        }
-    }
-    else
-    {
-        for (int i = 0; i < len; i++)
-        {
-            auto found = std::find(
-                pksm::internal::G1ENVals.begin(), pksm::internal::G1ENVals.end(), data[i + ofs]);
-            if (found == pksm::internal::G1ENVals.end())
-            {
-                break; // treat invalid character as terminator
-            }
-            char16_t codepoint =
-                pksm::internal::G1ENChars[std::distance(pksm::internal::G1ENVals.begin(), found)];
-            if (codepoint == u'\0')
-            {
-                break;
-            }
-            if (codepoint == pksm::internal::tradeOTChar)
-            {
-                continue;
-            }
-            if (transporter)
-            {
-                switch (codepoint)
-                {
-                    case u'[':
-                        codepoint = u'(';
-                        break;
-                    case u']':
-                        codepoint = u')';
-                        break;
-                    case u'×':
-                        codepoint = u'x';
-                }
-            }
-
-            auto [data, size] = codepointToUTF8(codepoint);
-
-            ret.append(data.data(), size);
-        }
-    }
-
+    StringWriter out{ret};
+    decodeString1(data, ofs, len, lang, transporter, out);
     return ret;
 }
 
+size_t StringUtils::getString1(const u8* data, int ofs, int len, pksm::Language lang,
+    std::span<char> out, bool transporter)
+{
+    BufferWriter writer{out};
+    decodeString1(data, ofs, len, lang, transporter, writer);
+    return writer.finish();
+}
+
 void StringUtils::setString1(u8* data, const std::string_view& v, int ofs, int len,
     pksm::Language lang, int padTo, u8 padWith)
 {
@@ -1110,14 +1026,12 @@ void StringUtils::setString1(u8* data, const std::string_view& v, int ofs, int l
 
             codepoint = tofullwidth(codepointToUCS2(codepoint));
 
-            auto found = std::find(
-                pksm::internal::G1JPChars.begin(), pksm::internal::G1JPChars.end(), codepoint);
-            if (found == pksm::internal::G1JPChars.end())
+            auto value = pksm::internal::G1JPCharToValue[codepoint];
+            if (!value)
             {
                 break;
             }
-            data[ofs + outPos++] =
-                pksm::internal::G1JPVals[std::distance(pksm::internal::G1JPChars.begin(), found)];
+            data[ofs + outPos++] = *value;
 
             inPos += advance;
         }
@@ -1128,14 +1042,12 @@ void StringUtils::setString1(u8* data, const std::string_view& v, int ofs, int l
         {
             auto [codepoint, advance] = UTF8toCodepoint(v.data() + inPos, v.size() - inPos);
 
-            auto found = std::find(pksm::internal::G1ENChars.begin(),
-                pksm::internal::G1ENChars.end(), codepointToUCS2(codepoint));
-            if (found == pksm::internal::G1ENChars.end())
+            auto value = pksm::internal::G1ENCharToValue[codepointToUCS2(codepoint)];
+            if (!value)
             {
                 break;
             }
-            data[ofs + outPos++] =
-                pksm::internal::G1ENVals[std::distance(pksm::internal::G1ENChars.begin(), found)];
+            data[ofs + outPos++] = *value;
 
             inPos += advance;
         }
@@ -1168,56 +1080,22 @@ std::string StringUtils::getString2(
 
     std::string ret;
     ret.reserve(len);
-    int inPos = 0;
+    StringWriter out{ret};
+    decodeString2KOR(data, ofs, len, out);
+    return ret;
+}
 
-    while (inPos < len)
+size_t StringUtils::getString2(const u8* data, int ofs, int len, pksm::Language lang,
+    std::span<char> out, bool transporter)
+{
+    if (lang != pksm::Language::KOR || data[ofs] == 0x5D)
     {
-        if (data[ofs + inPos] <= 0xB)
-        {
-            auto found = std::find(pksm::internal::G2KORVals.begin(),
-                pksm::internal::G2KORVals.end(), BigEndian::convertTo<u16>(data + ofs + inPos));
-            if (found == pksm::internal::G2KORVals.end())
-            {
-                break; // treat invalid value as terminator
-            }
-
-            inPos += 2;
-
-            auto [data, size] = codepointToUTF8(pksm::internal::G2KORChars[std::distance(
-                pksm::internal::G2KORVals.begin(), found)]);
-
-            ret.append(data.data(), size);
-        }
-        else
-        {
-            auto found = std::find(pksm::internal::G1ENVals.begin(), pksm::internal::G1ENVals.end(),
-                data[ofs + inPos]);
-            if (found == pksm::internal::G1ENVals.end())
-            {
-                break; // treat invalid value as terminator
-            }
-
-            inPos++;
-
-            char16_t codepoint =
-                pksm::internal::G1ENChars[std::distance(pksm::internal::G1ENVals.begin(), found)];
-
-            if (codepoint == u'\0')
-            {
-                break;
-            }
-            else if (codepoint == pksm::internal::tradeOTChar)
-            {
-                continue;
-            }
-
-            auto [data, size] = codepointToUTF8(codepoint);
-
-            ret.append(data.data(), size);
-        }
+        return getString1(data, ofs, len, lang, out, transporter);
     }
 
-    return ret;
+    BufferWriter writer{out};
+    decodeString2KOR(data, ofs, len, writer);
+    return writer.finish();
 }
 
 void StringUtils::setString2(u8* data, const std::string_view& v, int ofs, int len,
@@ -1238,25 +1116,20 @@ void StringUtils::setString2(u8* data, const std::string_view& v, int ofs, int l
 
         codepoint = tofullwidth(codepointToUCS2(codepoint));
 
-        auto found = std::find(
-            pksm::internal::G2KORChars.begin(), pksm::internal::G2KORChars.end(), codepoint);
-        if (found == pksm::internal::G2KORChars.end())
+        auto korValue = pksm::internal::G2KORCharToValue[codepoint];
+        if (!korValue)
         {
-            auto found = std::find(
-                pksm::internal::G1ENChars.begin(), pksm::internal::G1ENChars.end(), codepoint);
-            if (found == pksm::internal::G1ENChars.end())
+            auto value = pksm::internal::G1ENCharToValue[codepoint];
+            if (!value)
             {
                 break; // treat invalid character as terminator
             }
 
-            data[ofs + outPos++] =
-                pksm::internal::G1ENVals[std::distance(pksm::internal::G1ENChars.begin(), found)];
+            data[ofs + outPos++] = *value;
         }
         else
         {
-            u16 val =
-                pksm::internal::G2KORVals[std::distance(pksm::internal::G2KORChars.begin(), found)];
-            BigEndian::convertFrom<u16>(data + outPos, val);
+            BigEndian::convertFrom<u16>(data + outPos, *korValue);
             outPos += 2; // needs to be incremented twice, not just once
         }
 
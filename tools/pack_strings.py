@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""Packs each language folder in a strings folder into <folder>/<language>.bin, which i18n loads
+with a single read instead of opening every text file.
+
+Usage: pack_strings.py [strings folder]   (defaults to the strings folder next to this one)
+
+Format, all little endian:
+    0x00    "PKST"
+    0x04    u32 version
+    0x08    u32 file count
+    0x0C    u32 line count
+    0x10    s64 modification time of the newest text file, in whole seconds since the epoch
+    0x18    per file, sorted by name: u32 name line, u32 first line, u32 line count
+    then    per line, plus one for the end: u32 offset from the start of the blob
+    then    the lines, each followed by a null terminator
+
+Files are named the way i18n::load refers to them, such as "/species.txt" or
+"/subregions/001.txt", and their names are stored as lines after all of the files' lines. Lines
+are split the same way i18n::load reads the text files: without the line ending, cut off at a
+carriage return, and with no empty line for a trailing newline.
+
+i18n ignores a table if any text file it was packed from has since been modified or removed, so
+a stale table is never used in place of edited text files.
+"""
+
+import os
+import struct
+import sys
+
+VERSION = 2
+
+
+def read_lines(path):
+    with open(path, "rb") as f:
+        lines = f.read().split(b"\n")
+    if lines[-1] == b"":
+        lines.pop()
+    return [line.split(b"\0")[0].split(b"\r")[0] for line in lines]
+
+
+def pack(folder):
+    files = []
+    newest = 0
+    for root, _, names in os.walk(folder):
+        for name in names:
+            if name.endswith(".txt"):
+                path = os.path.join(root, name)
+                relative = os.path.relpath(path, folder).replace(os.sep, "/")
+                files.append((("/" + relative).encode(), read_lines(path)))
+                newest = max(newest, int(os.stat(path).st_mtime))
+    files.sort()
+
+    lines = []
+    ranges = []
+    for _, contents in files:
+        ranges.append((len(lines), len(contents)))
+        lines.extend(contents)
+    entries = []
+    for (name, _), (first, count) in zip(files, ranges):
+        entries.append((len(lines), first, count))
+        lines.append(name)
+
+    header = b"PKST" + struct.pack("<IIIq", VERSION, len(files), len(lines), newest)
+    index = b"".join(struct.pack("<III", *entry) for entry in entries)
+    offset = len(header) + len(index) + (len(lines) + 1) * 4
+    offsets = []
+    for line in lines:
+        offsets.append(offset)
+        offset += len(line) + 1
+    offsets.append(offset)
+
+    return (
+        header
+        + index
+        + struct.pack("<%dI" % len(offsets), *offsets)
+        + b"".join(line + b"\0" for line in lines)
+    )
+
+
+def main():
+    strings = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+        os.path.dirname(os.path.abspath(__file__)), "..", "strings"
+    )
+    for language in sorted(os.listdir(strings)):
+        folder = os.path.join(strings, language)
+        if os.path.isdir(folder):
+            with open(folder + ".bin", "wb") as f:
+                f.write(pack(folder))
+
+
+if __name__ == "__main__":
+    main()